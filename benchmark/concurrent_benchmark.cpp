@@ -0,0 +1,231 @@
+/**
+ * @file       <concurrent_benchmark.cpp>
+ * @brief      This source file is a stress test and throughput benchmark of ConcurrentHashIndex.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "generator/generator.hpp"
+
+#ifndef MODEL_HPP
+#include "model/model.hpp"
+#endif // MODEL_HPP
+
+#include "hashing/concurrent_index.hpp"
+#include "hashing/hash_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace
+{
+    struct StepResult
+    {
+        std::size_t     lookups = 0;
+        std::size_t     errors = 0;     ///< Preloaded keys not found, or found on a row with another hash.
+        std::size_t     inserts = 0;
+        double          seconds = 0.0;
+    };
+
+    /**
+     * @brief Runs the readers against one writer for the given time.
+     *
+     * The first half of the rows is inserted before the readers start and must always
+     * be found. The writer inserts the second half meanwhile, which grows the index
+     * several times under the readers.
+     */
+    template<typename Insert, typename Find>
+    StepResult run_step(const std::vector<std::uint32_t>& hashes, std::size_t readers, std::chrono::milliseconds duration, Insert&& insert, Find&& find)
+    {
+        std::size_t preloaded = hashes.size() / 2;
+
+        for (std::size_t row = 0; row < preloaded; ++row)
+        {
+            insert(hashes[row], static_cast<std::uint32_t>(row));
+        }
+
+        std::atomic<bool> running{true};
+        std::atomic<std::size_t> lookups{0};
+        std::atomic<std::size_t> errors{0};
+        std::atomic<std::size_t> inserts{0};
+        std::vector<std::thread> threads;
+
+        for (std::size_t reader = 0; reader < readers; ++reader)
+        {
+            threads.emplace_back([&, reader]()
+            {
+                std::size_t local_lookups = 0;
+                std::size_t local_errors = 0;
+                std::size_t row = (preloaded * reader) / readers;
+
+                while (running.load(std::memory_order_relaxed))
+                {
+                    for (std::size_t batch = 0; batch < 1024; ++batch)
+                    {
+                        std::optional<std::uint32_t> found = find(hashes[row]);
+
+                        if (!found.has_value() || found.value() >= hashes.size() || hashes[found.value()] != hashes[row])
+                        {
+                            ++local_errors;
+                        }
+
+                        row = (row + 7919 < preloaded) ? row + 7919 : (row + 7919) % preloaded;
+                    }
+                    local_lookups += 1024;
+                }
+
+                lookups += local_lookups;
+                errors += local_errors;
+            });
+        }
+
+        threads.emplace_back([&]()
+        {
+            for (std::size_t row = preloaded; row < hashes.size() && running.load(std::memory_order_relaxed); ++row)
+            {
+                insert(hashes[row], static_cast<std::uint32_t>(row));
+                ++inserts;
+            }
+        });
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        std::this_thread::sleep_for(duration);
+        running.store(false);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        StepResult result;
+        result.lookups = lookups.load();
+        result.errors = errors.load();
+        result.inserts = inserts.load();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    void print_step(const char* name, std::size_t readers, const StepResult& result)
+    {
+        std::cout << "\t " << std::setw(10) << std::left << name << std::right
+                  << "\t - Readers: " << std::setw(3) << readers
+                  << "\t Lookups: " << std::fixed << std::setprecision(2) << result.lookups / result.seconds / 1e6 << " M/s"
+                  << "\t Per reader: " << result.lookups / result.seconds / 1e6 / readers << " M/s"
+                  << "\t Inserts: " << result.inserts
+                  << "\t Errors: " << result.errors << std::endl;
+    }
+}
+
+int main(int argc, char const *argv[])
+{
+    std::size_t amount;
+    std::size_t max_readers;
+    std::size_t duration;
+
+    po::options_description desc("Default options");
+    desc.add_options()
+        ("help,H", "produces help message")
+        ("amount,A", po::value<std::size_t>(&amount)->default_value(1000000), "determines how many models are generated, half of them is inserted while reading, at least 2")
+        ("readers,R", po::value<std::size_t>(&max_readers)->default_value(0), "determines the largest number of reader threads, 0 for every hardware thread")
+        ("duration,D", po::value<std::size_t>(&duration)->default_value(500), "determines how long every step runs, in milliseconds");
+
+    po::variables_map variable_map;
+    po::store(po::parse_command_line(argc, argv, desc), variable_map);
+    po::notify(variable_map);
+
+    if (variable_map.count("help"))
+    {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    if (amount < 2)
+    {
+        std::cout << "the amount should be at least 2, so that some rows are preloaded" << "\n";
+        return 1;
+    }
+
+    if (max_readers == 0)
+    {
+        max_readers = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    Generator generator;
+    std::vector<std::uint32_t> hashes;
+
+    hashes.reserve(amount);
+
+    for (std::size_t index = 0; index < amount; ++index)
+    {
+        hashes.push_back(Hashing::wy_hashing_function(generator.model_generator().get_field<std::string>(0) + "#" + std::to_string(index)));
+    }
+
+    std::cout << "Concurrent lookups on " << amount / 2 << " preloaded rows while one writer inserts " << amount - amount / 2 << " more, " << duration << " ms per step: " << "\n";
+
+    std::vector<std::size_t> reader_counts;
+
+    for (std::size_t readers = 1; readers < max_readers; readers *= 2)
+    {
+        reader_counts.push_back(readers);
+    }
+    reader_counts.push_back(max_readers);
+
+    bool failed = false;
+
+    for (std::size_t readers : reader_counts)
+    {
+        ConcurrentHashIndex concurrent_index;
+
+        StepResult concurrent = run_step(hashes, readers, std::chrono::milliseconds(duration), [&](std::uint32_t hash, std::uint32_t row)
+        {
+            concurrent_index.insert(hash, row);
+        }, [&](std::uint32_t hash)
+        {
+            return concurrent_index.find(hash);
+        });
+
+        print_step("Lock-free", readers, concurrent);
+
+        HashIndex locked_index;
+        std::shared_mutex locked_mutex;
+
+        StepResult locked = run_step(hashes, readers, std::chrono::milliseconds(duration), [&](std::uint32_t hash, std::uint32_t row)
+        {
+            std::unique_lock<std::shared_mutex> lock(locked_mutex);
+            locked_index.insert(hash, row);
+        }, [&](std::uint32_t hash)
+        {
+            std::shared_lock<std::shared_mutex> lock(locked_mutex);
+            return locked_index.find(hash);
+        });
+
+        print_step("Shared lock", readers, locked);
+
+        failed = failed || concurrent.errors != 0 || locked.errors != 0;
+    }
+
+    return failed ? 1 : 0;
+}
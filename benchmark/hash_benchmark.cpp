@@ -0,0 +1,433 @@
+/**
+ * @file       <hash_benchmark.cpp>
+ * @brief      This source file is a benchmark of the hashing functions implemented in Hashing.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ * 
+ * @warning    This library is under development, so there might be some bugs in it.  
+ * @bug        Currently, there are no any known bugs. 
+ * 
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ * 
+ * @copyright  Copyright 2023 Alexander. All rights reserved. 
+ * 
+ *             (Not really)
+ */
+#include "generator/generator.hpp"
+
+#ifndef MODEL_HPP
+#include "model/model.hpp"
+#endif // MODEL_HPP
+
+#include "hashing/bloom_filter.hpp"
+#include "hashing/hash_index.hpp"
+#include "hashing/hash_postings.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace
+{
+    constexpr std::chrono::milliseconds min_throughput_time{200};  ///< Least time the throughput test hashes the block for.
+}
+
+int main(int argc, char const *argv[])
+{
+    std::size_t amount;
+    std::size_t iterations;
+    std::size_t block_size;
+    std::string file_path;
+
+    po::options_description desc("Default options");
+    desc.add_options()
+        ("help,H", "produces help message")
+        ("amount,A", po::value<std::size_t>(&amount)->default_value(1000000), "determines how many models are generated for the short key test")
+        ("iteration,I", po::value<std::size_t>(&iterations)->default_value(5), "determines how many times every test is repeated")
+        ("block,B", po::value<std::size_t>(&block_size)->default_value(1 << 20), "determines the size of the buffer hashed by the throughput test, at least 1")
+        ("file_name,F", po::value<std::string>(&file_path)->default_value(""), "loads models from the given file instead of generating them");
+
+    po::variables_map variable_map;
+    po::store(po::parse_command_line(argc, argv, desc), variable_map);
+    po::notify(variable_map);
+
+    if (variable_map.count("help")) 
+    {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    if (block_size == 0)
+    {
+        std::cout << "the block size should be at least 1" << "\n";
+        return 1;
+    }
+
+    std::vector<Model> model_vector;
+
+    if (file_path.empty())
+    {
+        Generator generator;
+
+        model_vector.reserve(amount);
+
+        for (std::size_t index = 0; index < amount; ++index)
+        {
+            model_vector.push_back(generator.model_generator());
+        }
+    }
+    else
+    {
+        Model::load_model(model_vector, file_path);
+    }
+
+    std::vector<std::string> names;
+    names.reserve(model_vector.size());
+
+    for (const Model& model : model_vector)
+    {
+        names.push_back(model.get_field<std::string>(0));
+    }
+
+    std::unordered_set<std::string_view> distinct_names(names.begin(), names.end());
+
+    std::string block(block_size, '\0');
+    std::mt19937 engine(42);
+
+    for (char& ch : block)
+    {
+        ch = static_cast<char>(engine());
+    }
+
+    std::cout << "Hash function benchmark on " << names.size() << " names (" << distinct_names.size() << " distinct), crc32c hardware: " << (Hashing::crc32c_hardware() ? "yes" : "no") << "\n";
+
+    std::uint32_t sink = 0;
+
+    for (std::uint8_t function = 0; function < Hashing::function_count; ++function)
+    {
+        Hashing::dispatch(function, [&](auto hash_function)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            std::chrono::duration<double> block_elapsed{0};
+            std::size_t block_rounds = 0;
+
+            // A few rounds of a small block end within the clock resolution, so the rounds
+            // are repeated until enough time has passed, reading the clock between them.
+            do
+            {
+                for (std::size_t iteration = 0; iteration < std::max<std::size_t>(1, iterations); ++iteration)
+                {
+                    block[block_rounds % block.size()] ^= static_cast<char>(sink);
+                    sink ^= hash_function(block);
+
+                    ++block_rounds;
+                }
+
+                block_elapsed = std::chrono::steady_clock::now() - start;
+            }
+            while (block_elapsed < min_throughput_time);
+
+            start = std::chrono::steady_clock::now();
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                for (const std::string& name : names)
+                {
+                    sink ^= hash_function(name);
+                }
+            }
+
+            std::chrono::duration<double, std::nano> key_elapsed = std::chrono::steady_clock::now() - start;
+
+            std::unordered_set<std::uint32_t> distinct_hashes;
+            distinct_hashes.reserve(distinct_names.size());
+
+            for (std::string_view name : distinct_names)
+            {
+                distinct_hashes.insert(hash_function(name));
+            }
+
+            std::vector<std::uint32_t> buckets(names.size());
+            std::size_t bucket_collisions = 0;
+
+            for (const std::string& name : names)
+            {
+                if (buckets[hash_function(name) % buckets.size()]++ > 0)
+                {
+                    ++bucket_collisions;
+                }
+            }
+
+            double bytes = static_cast<double>(block.size()) * block_rounds;
+            double keys = static_cast<double>(names.size()) * iterations;
+
+            std::cout << "\t Function: " << std::setw(8) << std::left << decltype(hash_function)::name << std::right
+                      << "\t - Throughput: " << std::fixed << std::setprecision(3) << bytes / block_elapsed.count() / 1e9 << " GB/s"
+                      << "\t Short keys: " << std::setprecision(2) << key_elapsed.count() / keys << " ns/key"
+                      << "\t Hash collisions: " << distinct_names.size() - distinct_hashes.size()
+                      << "\t Bucket collisions: " << bucket_collisions << std::endl;
+        });
+    }
+
+    std::cout << "Index build on " << model_vector.size() << " models, function object against std::function: " << "\n";
+
+    for (std::uint8_t function = 0; function < 3; ++function)
+    {
+        Hashing::dispatch(function, [&](auto hash_function)
+        {
+            std::function<std::uint32_t(std::string_view value)> erased_function = hash_function;
+
+            std::chrono::duration<double, std::milli> direct_elapsed{0};
+            std::chrono::duration<double, std::milli> erased_elapsed{0};
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                HashIndex direct_index = HashIndex::hash_model(model_vector, hash_function);
+                direct_elapsed += std::chrono::steady_clock::now() - start;
+
+                start = std::chrono::steady_clock::now();
+                HashIndex erased_index = HashIndex::hash_model(model_vector, erased_function);
+                erased_elapsed += std::chrono::steady_clock::now() - start;
+
+                sink ^= static_cast<std::uint32_t>(direct_index.size() ^ erased_index.size());
+            }
+
+            std::cout << "\t Function: " << std::setw(8) << std::left << decltype(hash_function)::name << std::right
+                      << "\t - Function object: " << std::fixed << std::setprecision(3) << direct_elapsed.count() / iterations << " ms"
+                      << "\t std::function: " << erased_elapsed.count() / iterations << " ms"
+                      << "\t Speedup: " << std::setprecision(2) << erased_elapsed.count() / direct_elapsed.count() << "x" << std::endl;
+        });
+    }
+
+    std::cout << "Dictionary lookup on " << model_vector.size() << " models: " << "\n";
+
+    for (std::uint8_t field : {std::uint8_t{1}, std::uint8_t{2}})
+    {
+        const ModelDictionary& dictionary = ModelDictionary::field_dictionary(field);
+
+        std::vector<std::string> values;
+        std::vector<std::string_view> keys;
+        std::map<std::string, std::uint16_t, std::less<>> tree;
+
+        values.reserve(model_vector.size());
+
+        for (const Model& model : model_vector)
+        {
+            values.push_back(model.get_field<std::string>(field));
+        }
+
+        for (std::size_t code = 0; code < dictionary.size(); ++code)
+        {
+            keys.push_back(dictionary.decode(static_cast<std::uint16_t>(code)));
+            tree.emplace(dictionary.decode(static_cast<std::uint16_t>(code)), static_cast<std::uint16_t>(code));
+        }
+
+        PerfectHash perfect_hash;
+        perfect_hash.build(keys);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (const std::string& value : values)
+            {
+                sink ^= dictionary.find(value).value_or(0);
+            }
+        }
+
+        std::chrono::duration<double, std::nano> perfect_elapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (const std::string& value : values)
+            {
+                sink ^= tree.find(value)->second;
+            }
+        }
+
+        std::chrono::duration<double, std::nano> tree_elapsed = std::chrono::steady_clock::now() - start;
+
+        double lookups = static_cast<double>(values.size()) * iterations;
+
+        std::cout << "\t Field: " << std::setw(10) << std::left << ((field == 1) ? "department" : "job_title") << std::right
+                  << "\t - Keys: " << dictionary.size()
+                  << "\t Perfect hash: " << std::fixed << std::setprecision(2) << perfect_elapsed.count() / lookups << " ns/lookup, " << perfect_hash.bytes() << " bytes"
+                  << "\t std::map: " << tree_elapsed.count() / lookups << " ns/lookup" << std::endl;
+    }
+
+    std::size_t request_size = std::min<std::size_t>(100000, names.size());
+
+    std::cout << "Batched lookups on " << names.size() << " names, requests of " << request_size << " keys: " << "\n";
+
+    if (request_size > 0)
+    {
+        HashIndex index(names.size());
+        HashPostings postings = HashPostings::hash_model(model_vector, Hashing::Wy{});
+        std::uniform_int_distribution<std::size_t> name_distribution(0, names.size() - 1);
+
+        std::vector<std::string> request_keys(request_size);
+        std::vector<std::uint32_t> request_hashes(request_size);
+        std::vector<std::optional<std::uint32_t>> request_results(request_size);
+
+        for (std::size_t row = 0; row < names.size(); ++row)
+        {
+            index.insert(Hashing::wy_hashing_function(names[row]), static_cast<std::uint32_t>(row));
+        }
+
+        for (std::size_t key = 0; key < request_size; ++key)
+        {
+            request_keys[key] = names[name_distribution(engine)];
+            request_hashes[key] = Hashing::wy_hashing_function(request_keys[key]);
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (std::size_t key = 0; key < request_size; ++key)
+            {
+                request_results[key] = index.find(request_hashes[key]);
+            }
+            sink ^= request_results[iteration % request_size].value_or(0);
+        }
+
+        std::chrono::duration<double, std::nano> single_elapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            index.find_many(request_hashes, request_results);
+            sink ^= request_results[iteration % request_size].value_or(0);
+        }
+
+        std::chrono::duration<double, std::nano> batch_elapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (const std::string& key : request_keys)
+            {
+                sink ^= static_cast<std::uint32_t>(postings.find(key).size());
+            }
+        }
+
+        std::chrono::duration<double, std::nano> postings_single_elapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (std::span<const std::uint32_t> rows : postings.find_many(request_keys))
+            {
+                sink ^= static_cast<std::uint32_t>(rows.size());
+            }
+        }
+
+        std::chrono::duration<double, std::nano> postings_batch_elapsed = std::chrono::steady_clock::now() - start;
+
+        double lookups = static_cast<double>(request_size) * iterations;
+
+        std::cout << "\t Flat index"
+                  << "\t - find: " << std::fixed << std::setprecision(2) << single_elapsed.count() / lookups << " ns/key"
+                  << "\t find_many: " << batch_elapsed.count() / lookups << " ns/key"
+                  << "\t Speedup: " << single_elapsed.count() / batch_elapsed.count() << "x" << std::endl;
+
+        std::cout << "\t Postings  "
+                  << "\t - find: " << postings_single_elapsed.count() / lookups << " ns/key"
+                  << "\t find_many: " << postings_batch_elapsed.count() / lookups << " ns/key"
+                  << "\t Speedup: " << postings_single_elapsed.count() / postings_batch_elapsed.count() << "x" << std::endl;
+    }
+
+    std::cout << "Bloom filter on " << request_size << " absent keys: " << "\n";
+
+    if (request_size > 0)
+    {
+        std::vector<std::list<Model>> chained_table = Hashing::hash_model(model_vector, Hashing::Wy{});
+        std::vector<std::uint32_t> absent_hashes;
+        std::unordered_set<std::uint32_t> present_hashes;
+
+        for (const Model& model : model_vector)
+        {
+            present_hashes.insert(model.get_hash());
+        }
+
+        for (std::size_t key = 0; absent_hashes.size() < request_size; ++key)
+        {
+            std::uint32_t hash = Hashing::wy_hashing_function(names[key % names.size()] + "#" + std::to_string(key));
+
+            if (!present_hashes.contains(hash))
+            {
+                absent_hashes.push_back(hash);
+            }
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (std::uint32_t hash : absent_hashes)
+            {
+                sink ^= Hashing::find_in_hash_table(chained_table, hash, chained_table.size()).has_value();
+            }
+        }
+
+        std::chrono::duration<double, std::nano> table_elapsed = std::chrono::steady_clock::now() - start;
+        double lookups = static_cast<double>(absent_hashes.size()) * iterations;
+
+        std::cout << "\t Chained table" << "\t - Lookup: " << std::fixed << std::setprecision(2) << table_elapsed.count() / lookups << " ns/key" << std::endl;
+
+        for (double false_positive_rate : {0.01, 0.001})
+        {
+            BloomFilter filter = BloomFilter::hash_model(model_vector, false_positive_rate);
+            std::size_t false_positives = 0;
+
+            start = std::chrono::steady_clock::now();
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                for (std::uint32_t hash : absent_hashes)
+                {
+                    if (filter.may_contain(hash))
+                    {
+                        ++false_positives;
+                        sink ^= Hashing::find_in_hash_table(chained_table, hash, chained_table.size()).has_value();
+                    }
+                }
+            }
+
+            std::chrono::duration<double, std::nano> filter_elapsed = std::chrono::steady_clock::now() - start;
+
+            std::cout << "\t Filter " << std::setprecision(3) << false_positive_rate
+                      << "\t - Lookup: " << std::setprecision(2) << filter_elapsed.count() / lookups << " ns/key"
+                      << "\t Speedup: " << table_elapsed.count() / filter_elapsed.count() << "x"
+                      << "\t False positives: " << std::setprecision(5) << static_cast<double>(false_positives) / lookups
+                      << "\t Memory: " << filter.bytes() << " bytes (" << std::setprecision(2) << filter.bits_per_key() << " bits per key)" << std::endl;
+        }
+    }
+
+    std::cout << "Checksum: " << sink << std::endl;
+
+    return 0;
+}
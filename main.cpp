@@ -22,14 +22,30 @@
 #include "../model/model.hpp"
 #endif // MODEL_HPP
 
+#ifndef MODEL_TABLE_HPP
+#include "./model/model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#ifndef ALLOCATION_COUNTER_HPP
+#include "./model/allocation_counter.hpp"
+#endif // ALLOCATION_COUNTER_HPP
+
 #include "./sorting/sorting.hpp"
 #include "./search/search.hpp"
+#include "./hashing/bloom_filter.hpp"
+#include "./hashing/hash_index.hpp"
+#include "./hashing/hash_postings.hpp"
+#include "./hashing/mapped_index.hpp"
+#include "./hashing/partitioned_index.hpp"
 
 #include <iostream>
 #include <random>
 #include <boost/program_options.hpp>
 #include <algorithm>
 #include <bitset>
+#include <deque>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <thread>
 #include <map>
@@ -41,6 +57,8 @@ int main(int argc, char const *argv[])
 	std::size_t amount;
     std::size_t iterations;
     std::size_t mode;
+    std::size_t threads;
+    double filter_rate;
     bool silent;
     std::string file_path;
     std::string search_tag;
@@ -57,12 +75,18 @@ int main(int argc, char const *argv[])
     	("amount,A", po::value<std::size_t>(&amount)->default_value(100), "determines how many lines does debug output prints")
         ("iteration,I", po::value<std::size_t>(&iterations)->default_value(10), "determines how many testion iterations there should be")
         ("mode,M", po::value<std::size_t>(&mode)->default_value(0), "determines wich row should be sorted")
+        ("threads,P", po::value<std::size_t>(&threads)->default_value(0), "determines how many threads parallel builds and sorts use (0 - every hardware thread)")
         ("silent,S", po::value<bool>(&silent)->default_value(false), "mutes output of models")
         ("file_name,F", po::value<std::string>(&file_path)->default_value("./set_data/"), "specifies file path to write/load model without .json")
         ("value,V", po::value<std::string>(&search_tag)->default_value(" "), "specifies value, that should be searched for in the array")
         ("binary,B", "makes it so, that code runs lab 2")
         ("hashing,X", "makes it so, that code runs lab 3")
+        ("filter,E", po::value<double>(&filter_rate)->default_value(0.0), "puts a Bloom filter with the given false positive rate in front of lab 3 lookups (0 - no filter)")
+        ("statistics,J", "additionally prints hash table statistics as JSON in lab 3")
+        ("persist,Y", "keeps a memory-mapped hash index next to every loaded dataset (<dataset>.hidx) and queries it before the dataset is parsed in lab 3")
         ("random,R", "makes it so, that code runs lab 4")
+        ("columnar,C", "additionally runs sorting and searching on columnar model table")
+        ("keys,K", "additionally runs sorting and searching on normalized sort keys")
         ("load,L", "loads model from file")
         ("generate,G", "generates model and writes it into file")
         ("test,T", "performs some tests on given data")
@@ -85,35 +109,86 @@ int main(int argc, char const *argv[])
         return 1;
     }
 
+    // Every dataset owns an arena, its models are freed all at once when the arena goes away.
+    std::deque<std::pmr::monotonic_buffer_resource> model_arena_set;
+
     std::vector<Model> model_vector;
     std::vector<std::vector<Model>> model_vector_set;
 
+    // Dataset files of model_vector_set and whether their persisted hash index is up to date.
+    std::vector<std::filesystem::path> dataset_path_set;
+    std::vector<bool> mapped_index_set;
+
     std::filesystem::path avg_file_path(file_path);
 
     
     if (variable_map.count("generate"))
     {
         Generator generator;
+
+        // The batch timing draws its rows from a generator of its own, so it does not
+        // advance the generator the saved datasets come from.
+        std::optional<Generator> batch_generator;
+
+        if (variable_map.count("columnar"))
+        {
+            batch_generator.emplace();
+        }
         
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
+            std::pmr::monotonic_buffer_resource& model_arena = model_arena_set.emplace_back();
+            std::vector<Model>& model_dataset = model_vector_set.emplace_back();
+
+            // Every dataset holds the rows of the previous one followed by the new rows. The old
+            // rows are copied with their own allocator, so each name stays in the arena of the
+            // iteration that generated it.
+            if (iteration > 0)
+            {
+                const std::vector<Model>& previous_dataset = model_vector_set[iteration - 1];
+
+                model_dataset.reserve(previous_dataset.size() + amount);
+
+                for (const Model& model : previous_dataset)
+                {
+                    model_dataset.emplace_back(model, model.get_allocator());
+                }
+            }
+            else
+            {
+                model_dataset.reserve(amount);
+            }
+
             start = std::chrono::high_resolution_clock::now();
 
             for (std::size_t index = 0; index < amount; ++index)
             {
-                model_vector.push_back(generator.model_generator());
+                model_dataset.push_back(generator.model_generator(&model_arena));
             }
 
             finish = std::chrono::high_resolution_clock::now();
-
-            model_vector_set.push_back(model_vector);
             
             std::chrono::duration<double, std::milli> elapsed = finish - start;
             std::cout << "\t Iteration: " << iteration << "\t - Model generation took: " << elapsed.count() << " ms" << std::endl;
 
+            if (variable_map.count("columnar"))
+            {
+                ModelBatch model_batch(amount);
+
+                start = std::chrono::high_resolution_clock::now();
+
+                batch_generator->generate_batch(model_batch, amount);
+                ModelTable model_table = model_batch.finish();
+
+                finish = std::chrono::high_resolution_clock::now();
+
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Batch generation of " << model_table.size() << " rows took: " << elapsed.count() << " ms" << std::endl;
+            }
+
             if (variable_map.count("debug")) 
             {
-                Model::print_model(model_vector);
+                Model::print_model(model_dataset);
             }
 
             if (avg_file_path.has_filename())
@@ -131,11 +206,11 @@ int main(int argc, char const *argv[])
                 avg_file_path.replace_extension("");
                 avg_file_path.replace_filename(new_filename + file_extension);
 
-                Model::save_model(model_vector, avg_file_path);
+                Model::save_model(model_dataset, avg_file_path);
             }
             else
             {
-                Model::save_model(model_vector, std::filesystem::path(avg_file_path.string() + "model_data_" + std::to_string(iteration) + ".json"));
+                Model::save_model(model_dataset, std::filesystem::path(avg_file_path.string() + "model_data_" + std::to_string(iteration) + ".json"));
             }
         }
     }
@@ -143,6 +218,9 @@ int main(int argc, char const *argv[])
     {
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
+            std::pmr::monotonic_buffer_resource& model_arena = model_arena_set.emplace_back();
+            std::filesystem::path dataset_path;
+
             if (avg_file_path.has_filename())
             {
                 std::string file_extension = avg_file_path.extension().string();
@@ -158,25 +236,68 @@ int main(int argc, char const *argv[])
                 avg_file_path.replace_extension("");
                 avg_file_path.replace_filename(new_filename + file_extension);
 
-                Model::load_model(model_vector, avg_file_path);
+                dataset_path = avg_file_path;
             }
             else
             {
-                std::cout << "Loading: " << std::filesystem::path(avg_file_path.string() + "model_data_" + std::to_string(iteration) + ".json") << std::endl;
-                Model::load_model(model_vector, std::filesystem::path(avg_file_path.string() + "model_data_" + std::to_string(iteration) + ".json"));
+                dataset_path = std::filesystem::path(avg_file_path.string() + "model_data_" + std::to_string(iteration) + ".json");
+                std::cout << "Loading: " << dataset_path << std::endl;
+            }
+
+            bool mapped_index_valid = false;
+
+            if (variable_map.count("persist") && variable_map.count("hashing"))
+            {
+                try
+                {
+                    start = std::chrono::high_resolution_clock::now();
+
+                    // Loaded models hash their full name, so that is the field lab 3 saves the index with.
+                    MappedHashIndex mapped_index = MappedHashIndex::open(MappedHashIndex::index_path(dataset_path), dataset_path, Field::Name::index);
+                    std::optional<std::uint32_t> mapped_result = mapped_index.find(Hashing::dispatch(mapped_index.hash_function(), [&](auto hash_function)
+                    {
+                        return hash_function(search_tag);
+                    }));
+
+                    finish = std::chrono::high_resolution_clock::now();
+
+                    elapsed = finish - start;
+                    std::cout << "\t Mapped index: " << iteration << " found at row: " << (mapped_result.has_value() ? std::to_string(mapped_result.value()) : "none") << "\t - Opening and searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Rows: " << mapped_index.size() << "\t Memory: " << mapped_index.bytes() << " bytes" << std::endl;
+
+                    mapped_index_valid = true;
+                }
+                catch (const std::runtime_error& exception)
+                {
+                    std::cout << "\t Mapped index: " << iteration << "\t - " << exception.what() << ", it is rebuilt in lab 3" << std::endl;
+                }
+            }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            Model::load_model(model_vector, dataset_path, &model_arena);
+
+            finish = std::chrono::high_resolution_clock::now();
+
+            if (variable_map.count("persist"))
+            {
+                elapsed = finish - start;
+                std::cout << "\t Dataset: " << iteration << "\t - Loading took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
             }
 
-            model_vector_set.push_back(model_vector);
+            model_vector_set.push_back(std::move(model_vector));
+            dataset_path_set.push_back(dataset_path);
+            mapped_index_set.push_back(mapped_index_valid);
 
             if (variable_map.count("debug")) 
             {
-                Model::print_model(model_vector);
+                Model::print_model(model_vector_set.back());
             }
         }
     }
 
     if (variable_map.count("test"))
     {
+        std::pmr::unsynchronized_pool_resource test_model_pool;
         std::vector<Model> test_model_vector;
 
         // Bubble sorting
@@ -184,7 +305,9 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
 
             start = std::chrono::high_resolution_clock::now();
 
@@ -193,7 +316,7 @@ int main(int argc, char const *argv[])
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
-            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
 
             if (variable_map.count("debug")) 
             {
@@ -206,7 +329,9 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
 
             start = std::chrono::high_resolution_clock::now();
 
@@ -215,7 +340,7 @@ int main(int argc, char const *argv[])
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
-            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
 
             if (variable_map.count("debug")) 
             {
@@ -228,7 +353,9 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
 
             start = std::chrono::high_resolution_clock::now();
 
@@ -237,26 +364,231 @@ int main(int argc, char const *argv[])
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
-            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
 
             if (variable_map.count("debug")) 
             {
                 Model::print_model(test_model_vector);
             }
         }
+
+        // Parallel merge sorting
+        std::cout << "Parallel merge sorting: " << "\n";  
+
+        WorkStealingPool sort_pool(threads);
+        std::vector<Model> sort_buffer;
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
+
+            start = std::chrono::high_resolution_clock::now();
+
+            Sorting::parallel_merge_sort(test_model_vector, mode, sort_pool, sort_buffer);
+
+            finish = std::chrono::high_resolution_clock::now();
         
+            elapsed = finish - start;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+            if (variable_map.count("debug")) 
+            {
+                Model::print_model(test_model_vector);
+            }
+        }
+
+        // Fast sorting
+        std::cout << "Fast sorting: " << "\n";  
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
+
+            start = std::chrono::high_resolution_clock::now();
+
+            Sorting::fast_sort(test_model_vector, mode);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+            if (variable_map.count("debug")) 
+            {
+                Model::print_model(test_model_vector);
+            }
+        }
+
+        // Radix sorting
+        std::cout << "Radix sorting: " << "\n";  
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            AllocationCounter::reset();
+
+            start = std::chrono::high_resolution_clock::now();
+
+            Sorting::radix_sort(test_model_vector, mode);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+            if (variable_map.count("debug")) 
+            {
+                Model::print_model(test_model_vector);
+            }
+        }
+
+        if (variable_map.count("columnar"))
+        {
+            ModelTable test_model_table;
+
+            // Heap sorting (columnar)
+            std::cout << "Heap sorting (columnar): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                test_model_table = ModelTable(model_vector_set.at(iteration));
+
+                AllocationCounter::reset();
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::heap_sort(test_model_table, mode);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+                if (variable_map.count("debug")) 
+                {
+                    ModelTable::print_table(test_model_table);
+                }
+            }
+
+            // Merge sorting (columnar)
+            std::cout << "Merge sorting (columnar): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                test_model_table = ModelTable(model_vector_set.at(iteration));
+
+                AllocationCounter::reset();
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::merge_sort(test_model_table, mode);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+                if (variable_map.count("debug")) 
+                {
+                    ModelTable::print_table(test_model_table);
+                }
+            }
+
+            // Radix sorting (columnar)
+            std::cout << "Radix sorting (columnar): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                test_model_table = ModelTable(model_vector_set.at(iteration));
+
+                AllocationCounter::reset();
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::radix_sort(test_model_table, mode);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+                if (variable_map.count("debug")) 
+                {
+                    ModelTable::print_table(test_model_table);
+                }
+            }
+        }
+
+        if (variable_map.count("keys"))
+        {
+            ModelKeyEncoder encoder({static_cast<std::uint8_t>(mode)});
+
+            // Heap sorting (keys)
+            std::cout << "Heap sorting (keys): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+                AllocationCounter::reset();
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::heap_sort(test_model_vector, encoder);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+                if (variable_map.count("debug")) 
+                {
+                    Model::print_model(test_model_vector);
+                }
+            }
+
+            // Merge sorting (keys)
+            std::cout << "Merge sorting (keys): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+                AllocationCounter::reset();
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::merge_sort(test_model_vector, encoder);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << "\t - Sorting took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Allocations: " << (AllocationCounter::enabled ? std::to_string(AllocationCounter::allocations()) : "not counted") << std::endl;
+
+                if (variable_map.count("debug")) 
+                {
+                    Model::print_model(test_model_vector);
+                }
+            }
+        }
     }
 
     if (variable_map.count("binary"))
     {
         int serching_result = 0;
+        std::pmr::unsynchronized_pool_resource test_model_pool;
         std::vector<Model> test_model_vector;
 
         std::cout << "Straight searching: " << "\n";  
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             start = std::chrono::high_resolution_clock::now();
 
@@ -277,7 +609,7 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             Sorting::heap_sort(test_model_vector, mode);
 
@@ -300,7 +632,7 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             start = std::chrono::high_resolution_clock::now();
 
@@ -319,10 +651,83 @@ int main(int argc, char const *argv[])
             }
         }
 
+        if (variable_map.count("columnar"))
+        {
+            ModelTable test_model_table;
+
+            std::cout << "Straight searching (columnar): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                test_model_table = ModelTable(model_vector_set.at(iteration));
+
+                start = std::chrono::high_resolution_clock::now();
+
+                serching_result = Search::straight_search<std::string>(test_model_table, search_tag, mode);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << " found at: " << serching_result << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+            }
+
+            std::cout << "Binary searching (columnar, sort): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                test_model_table = ModelTable(model_vector_set.at(iteration));
+
+                start = std::chrono::high_resolution_clock::now();
+
+                Sorting::heap_sort(test_model_table, mode);
+
+                serching_result = Search::binary_search<std::string>(test_model_table, search_tag, mode);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << " found at: " << serching_result << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+
+                if (variable_map.count("debug") && serching_result >= 0) 
+                {
+                    std::cout << test_model_table.at(serching_result) << std::endl;
+                }
+            }
+        }
+
+        if (variable_map.count("keys"))
+        {
+            ModelKeyEncoder encoder({static_cast<std::uint8_t>(mode)});
+            std::vector<ModelKey> keys;
+
+            std::cout << "Binary searching (keys, sort): " << "\n";  
+
+            for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+                start = std::chrono::high_resolution_clock::now();
+
+                keys = Sorting::merge_sort(test_model_vector, encoder);
+
+                serching_result = Search::binary_search<std::string>(test_model_vector, keys, encoder, search_tag);
+
+                finish = std::chrono::high_resolution_clock::now();
+            
+                elapsed = finish - start;
+                std::cout << "\t Iteration: " << iteration << " found at: " << serching_result << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+
+                if (variable_map.count("debug") && serching_result >= 0) 
+                {
+                    std::cout << test_model_vector.at(serching_result) << std::endl;
+                }
+            }
+        }
+
         std::cout << "Map key searching: " << "\n"; 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
             std::map<std::string, std::size_t> test_model_map;
             std::map<std::string, std::size_t>::iterator test_model_iterator;
 
@@ -351,8 +756,12 @@ int main(int argc, char const *argv[])
     if (variable_map.count("hashing"))
     {
         std::optional<Model> serching_result;
+        std::pmr::unsynchronized_pool_resource test_model_pool;
         std::vector<Model> test_model_vector;
         std::vector<std::list<Model>> hashing_table;
+        std::optional<std::uint32_t> index_result;
+        HashIndex hashing_index;
+        BloomFilter hashing_filter;
         
         std::uint32_t searching_hash = Hashing::basic_hashing_function(search_tag);
 
@@ -360,17 +769,29 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             start = std::chrono::high_resolution_clock::now();
 
-            hashing_table = Hashing::hash_model(test_model_vector, &Hashing::basic_hashing_function);
+            hashing_table = Hashing::hash_model(test_model_vector, Hashing::Basic{});
 
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
             std::cout << "\t Hashing: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t There were total of: " << Hashing::count_collisions(hashing_table) << " collisions. " << std::endl;
 
+            if (filter_rate > 0.0)
+            {
+                start = std::chrono::high_resolution_clock::now();
+
+                hashing_filter = BloomFilter::hash_model(test_model_vector, filter_rate);
+
+                finish = std::chrono::high_resolution_clock::now();
+
+                elapsed = finish - start;
+                std::cout << "\t Filter: " << iteration << "\t - Building took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Memory: " << hashing_filter.bytes() << " bytes (" << std::setprecision(2) << hashing_filter.bits_per_key() << " bits per key)" << "\t Expected false positive rate: " << std::setprecision(6) << hashing_filter.expected_false_positive_rate() << std::endl;
+            }
+
             if (variable_map.count("debug")) 
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
@@ -378,7 +799,14 @@ int main(int argc, char const *argv[])
 
             start = std::chrono::high_resolution_clock::now();
 
-            serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            if (filter_rate > 0.0 && !hashing_filter.may_contain(searching_hash))
+            {
+                serching_result = std::nullopt;
+            }
+            else
+            {
+                serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            }
 
             finish = std::chrono::high_resolution_clock::now();
         
@@ -390,6 +818,37 @@ int main(int argc, char const *argv[])
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
             }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            hashing_index = HashIndex::hash_model(test_model_vector, Hashing::Basic{});
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Flat index: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Load factor: " << static_cast<double>(hashing_index.size()) / hashing_index.capacity() << std::endl;
+
+            if (variable_map.count("statistics"))
+            {
+                boost::json::object statistics;
+
+                statistics.emplace("function", "basic");
+                statistics.emplace("iteration", iteration);
+                statistics.emplace("chained", HashStatistics::chained(hashing_table).to_json());
+                statistics.emplace("flat", hashing_index.statistics().to_json());
+
+                std::cout << boost::json::serialize(statistics) << std::endl;
+            }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            index_result = hashing_index.find(searching_hash);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            
+            std::cout << "\t Iteration: " << iteration << " found: " << ((index_result.has_value() == true) ? test_model_vector.at(index_result.value()).get_field<std::string>(0) : "\b\b\b\b\b\b\bnot found") << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
         }
 
         std::cout << "Djb2 hash table search searching: " << "\n";  
@@ -400,17 +859,29 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             start = std::chrono::high_resolution_clock::now();
 
-            hashing_table = Hashing::hash_model(test_model_vector, &Hashing::djb2_hashing_function);
+            hashing_table = Hashing::hash_model(test_model_vector, Hashing::Djb2{});
 
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
             std::cout << "\t Hashing: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t There were total of: " << Hashing::count_collisions(hashing_table) << " collisions. " << std::endl;
 
+            if (filter_rate > 0.0)
+            {
+                start = std::chrono::high_resolution_clock::now();
+
+                hashing_filter = BloomFilter::hash_model(test_model_vector, filter_rate);
+
+                finish = std::chrono::high_resolution_clock::now();
+
+                elapsed = finish - start;
+                std::cout << "\t Filter: " << iteration << "\t - Building took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Memory: " << hashing_filter.bytes() << " bytes (" << std::setprecision(2) << hashing_filter.bits_per_key() << " bits per key)" << "\t Expected false positive rate: " << std::setprecision(6) << hashing_filter.expected_false_positive_rate() << std::endl;
+            }
+
             if (variable_map.count("debug")) 
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
@@ -418,7 +889,14 @@ int main(int argc, char const *argv[])
 
             start = std::chrono::high_resolution_clock::now();
 
-            serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            if (filter_rate > 0.0 && !hashing_filter.may_contain(searching_hash))
+            {
+                serching_result = std::nullopt;
+            }
+            else
+            {
+                serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            }
 
             finish = std::chrono::high_resolution_clock::now();
         
@@ -430,6 +908,64 @@ int main(int argc, char const *argv[])
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
             }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            hashing_index = HashIndex::hash_model(test_model_vector, Hashing::Djb2{});
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Flat index: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Load factor: " << static_cast<double>(hashing_index.size()) / hashing_index.capacity() << std::endl;
+
+            if (variable_map.count("statistics"))
+            {
+                boost::json::object statistics;
+
+                statistics.emplace("function", "djb2");
+                statistics.emplace("iteration", iteration);
+                statistics.emplace("chained", HashStatistics::chained(hashing_table).to_json());
+                statistics.emplace("flat", hashing_index.statistics().to_json());
+
+                std::cout << boost::json::serialize(statistics) << std::endl;
+            }
+
+            if (variable_map.count("persist") && iteration < dataset_path_set.size() && !mapped_index_set.at(iteration))
+            {
+                std::vector<std::uint32_t> row_hashes;
+                row_hashes.reserve(test_model_vector.size());
+
+                std::uint8_t row_field = Field::dispatch(test_model_vector.empty() ? Field::Name::index : test_model_vector.front().get_hash_field(), [](auto tag)
+                {
+                    return decltype(tag)::index;
+                });
+
+                for (const Model& model : test_model_vector)
+                {
+                    row_hashes.push_back(model.get_hash());
+                }
+
+                start = std::chrono::high_resolution_clock::now();
+
+                MappedHashIndex::save(MappedHashIndex::index_path(dataset_path_set.at(iteration)), dataset_path_set.at(iteration), row_hashes, Hashing::Djb2::id, row_field);
+
+                finish = std::chrono::high_resolution_clock::now();
+
+                elapsed = finish - start;
+                std::cout << "\t Mapped index: " << iteration << "\t - Saving took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t File: " << MappedHashIndex::index_path(dataset_path_set.at(iteration)) << std::endl;
+
+                mapped_index_set.at(iteration) = true;
+            }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            index_result = hashing_index.find(searching_hash);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            
+            std::cout << "\t Iteration: " << iteration << " found: " << ((index_result.has_value() == true) ? test_model_vector.at(index_result.value()).get_field<std::string>(0) : "\b\b\b\b\b\b\bnot found") << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
         }
 
         std::cout << "Advanced hash table search searching: " << "\n";  
@@ -440,17 +976,29 @@ int main(int argc, char const *argv[])
 
         for (std::size_t iteration = 0; iteration < iterations; ++iteration)
         {
-            test_model_vector = model_vector_set.at(iteration);
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
 
             start = std::chrono::high_resolution_clock::now();
 
-            hashing_table = Hashing::hash_model(test_model_vector, &Hashing::advanced_hashing_function);
+            hashing_table = Hashing::hash_model(test_model_vector, Hashing::Advanced{});
 
             finish = std::chrono::high_resolution_clock::now();
         
             elapsed = finish - start;
             std::cout << "\t Hashing: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t There were total of: " << Hashing::count_collisions(hashing_table) << " collisions. " << std::endl;
 
+            if (filter_rate > 0.0)
+            {
+                start = std::chrono::high_resolution_clock::now();
+
+                hashing_filter = BloomFilter::hash_model(test_model_vector, filter_rate);
+
+                finish = std::chrono::high_resolution_clock::now();
+
+                elapsed = finish - start;
+                std::cout << "\t Filter: " << iteration << "\t - Building took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Memory: " << hashing_filter.bytes() << " bytes (" << std::setprecision(2) << hashing_filter.bits_per_key() << " bits per key)" << "\t Expected false positive rate: " << std::setprecision(6) << hashing_filter.expected_false_positive_rate() << std::endl;
+            }
+
             if (variable_map.count("debug")) 
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
@@ -458,7 +1006,14 @@ int main(int argc, char const *argv[])
 
             start = std::chrono::high_resolution_clock::now();
 
-            serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            if (filter_rate > 0.0 && !hashing_filter.may_contain(searching_hash))
+            {
+                serching_result = std::nullopt;
+            }
+            else
+            {
+                serching_result = Hashing::find_in_hash_table(hashing_table, searching_hash, test_model_vector.size());
+            }
 
             finish = std::chrono::high_resolution_clock::now();
         
@@ -470,6 +1025,122 @@ int main(int argc, char const *argv[])
             {
                 std::cout << search_tag << /*test_model_vector.at(serching_result)*/" " << std::endl;
             }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            hashing_index = HashIndex::hash_model(test_model_vector, Hashing::Advanced{});
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Flat index: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Load factor: " << static_cast<double>(hashing_index.size()) / hashing_index.capacity() << std::endl;
+
+            if (variable_map.count("statistics"))
+            {
+                boost::json::object statistics;
+
+                statistics.emplace("function", "advanced");
+                statistics.emplace("iteration", iteration);
+                statistics.emplace("chained", HashStatistics::chained(hashing_table).to_json());
+                statistics.emplace("flat", hashing_index.statistics().to_json());
+
+                std::cout << boost::json::serialize(statistics) << std::endl;
+            }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            index_result = hashing_index.find(searching_hash);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            
+            std::cout << "\t Iteration: " << iteration << " found: " << ((index_result.has_value() == true) ? test_model_vector.at(index_result.value()).get_field<std::string>(0) : "\b\b\b\b\b\b\bnot found") << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+        }
+
+        std::cout << "Postings search (djb2, verified keys): " << "\n";
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            start = std::chrono::high_resolution_clock::now();
+
+            HashPostings hashing_postings = HashPostings::hash_model(test_model_vector, Hashing::Djb2{}, static_cast<std::uint8_t>((mode < 3) ? mode : 0));
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Postings: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t There were total of: " << hashing_postings.key_count() << " distinct keys. " << std::endl;
+
+            start = std::chrono::high_resolution_clock::now();
+
+            std::span<const std::uint32_t> postings_result = hashing_postings.find(search_tag);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            
+            std::cout << "\t Iteration: " << iteration << " found: " << postings_result.size() << " rows" << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
+
+            if (variable_map.count("debug")) 
+            {
+                for (std::uint32_t row : postings_result)
+                {
+                    std::cout << test_model_vector.at(row) << std::endl;
+                }
+            }
+        }
+
+        std::cout << "Parallel partitioned index (djb2, " << PartitionedHashIndex::thread_count(threads) << " threads): " << "\n";
+
+        searching_hash = Hashing::djb2_hashing_function(search_tag);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            Model::copy_model(model_vector_set.at(iteration), test_model_vector, &test_model_pool);
+
+            start = std::chrono::high_resolution_clock::now();
+
+            HashIndex serial_index = HashIndex::hash_model(test_model_vector, Hashing::Djb2{});
+
+            finish = std::chrono::high_resolution_clock::now();
+
+            std::chrono::duration<double, std::milli> serial_elapsed = finish - start;
+
+            start = std::chrono::high_resolution_clock::now();
+
+            PartitionedHashIndex parallel_index = PartitionedHashIndex::hash_model(test_model_vector, Hashing::Djb2{}, threads);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            std::cout << "\t Partitioned: " << iteration << "\t - Hashing took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << "\t Serial took: " << serial_elapsed.count() << "\t ms" << "\t Speedup: " << std::setprecision(2) << serial_elapsed.count() / elapsed.count() << "x" << "\t Partitions: " << parallel_index.partition_count() << "\t Rows: " << serial_index.size() << std::endl;
+
+            if (variable_map.count("statistics"))
+            {
+                boost::json::object statistics;
+
+                statistics.emplace("function", "djb2");
+                statistics.emplace("iteration", iteration);
+                statistics.emplace("partitioned", parallel_index.statistics().to_json());
+
+                std::cout << boost::json::serialize(statistics) << std::endl;
+            }
+
+            start = std::chrono::high_resolution_clock::now();
+
+            index_result = parallel_index.find(searching_hash);
+
+            finish = std::chrono::high_resolution_clock::now();
+        
+            elapsed = finish - start;
+            
+            std::cout << "\t Iteration: " << iteration << " found: " << ((index_result.has_value() == true) ? test_model_vector.at(index_result.value()).get_field<std::string>(0) : "\b\b\b\b\b\b\bnot found") << "\t - Searching took: " << std::fixed << std::setprecision(6) << elapsed.count() << "\t ms" << std::endl;
         }
     }
 
@@ -26,6 +26,19 @@ Generator::Generator()
     this->_department_list = {" ", "Account Management", "Accounting", "Architecture", "Asset Management", "Branding", "Building Management", "Business Analysis", "Business Development", "Clinical Affairs", "Clinical Operations", "Clinical Research", "Compliance", "Content Editing", "Content Marketing", "Contract Management", "Copywriting", "Coaching", "Construction", "Consulting", "Customer Service", "Customer Success", "Customer Support", "Cybersecurity", "Data Analytics", "Data Center Management", "Database Administration", "DevOps", "Digital Marketing", "Distribution", "Editing", "Email Marketing", "Energy Management", "Engineering", "Environmental Compliance", "Environmental Health and Safety", "Event Marketing", "Facilities Management", "Finance", "Financial Planning", "Grant Writing", "Graphic Design", "Help Desk", "Hedge Fund", "Home Inspection", "Human Resources", "Import and Export", "Information Technology", "Information Security", "Innovation", "Instructional Design", "Insurance", "Intellectual Property", "Interior Design", "Investment Banking", "Journalism", "Land Management", "Legal", "Legal Research", "Linguistics", "Logistics", "Localization", "Market Research", "Marketing", "Materials Management", "Medical Affairs", "Medical Writing", "Mobile App Development", "Mutual Fund", "Network Administration", "Network Operations", "Occupational Health and Safety", "Operations", "Pharmaceutical Sales", "Pharmacovigilance", "Product Development", "Product Management", "Proofreading", "Property Management", "Proposal Writing", "Project Management", "Public Relations", "Publicity", "Procurement", "Publishing", "Purchasing", "Quality Assurance", "Quality Control", "Real Estate", "Regulatory Affairs", "Research", "Renewable Energy", "Risk Assessment", "Risk Management", "Sales", "Sales Operations", "Shipping and Receiving", "SEM", "SEO", "Social Media", "Software Development", "Sustainability", "Supply Chain", "Supply Chain Management", "System Administration", "System Architecture", "Technical Support", "Technical Writing", "Tax Planning", "Teaching", "Testing", "Test Automation", "Training", "Training and Development", "Translation", "User Experience Design", "User Interface Design", "Venture Capital", "Virtualization", "Waste Management", "Water Management", "Web Development", "Wealth Management", "Academic Administration", "Advertising", "Aerospace Engineering", "Agribusiness", "Air Traffic Control", "Aircraft Maintenance", "Alternative Energy", "Analytics", "Animation", "Application Development", "Aquaculture", "Artificial Intelligence", "Asset Tracking", "Audio Engineering", "Augmented Reality", "Automotive Engineering", "Aviation", "Banking", "Behavioral Science", "Bilingual Education", "Biomedical Engineering", "Biotechnology", "Brand Management", "Business Intelligence", "Business Operations", "Business Writing", "CAD Design", "Capital Markets", "Career Counseling", "Chemical Engineering", "Chemistry", "Childcare", "Civil Engineering", "Clean Energy", "Climate Change", "Cloud Computing", "Coaching and Mentoring", "Commercial Banking", "Commercial Law", "Communication", "Community Outreach", "Computer Hardware Engineering", "Computer Science", "Construction Management", "Consumer Research", "Content Strategy", "Corporate Law", "Corporate Training", "Counseling", "Creative Writing", "Criminal Justice", "Cryptocurrency", "Culinary Arts", "Customer Experience", "Cybersecurity Engineering", "Data Entry", "Data Management", "Data Science", "Data Visualization", "Dentistry", "Design", "Digital Design", "Digital Photography", "Direct Marketing", "Disaster Recovery", "Diversity and Inclusion", "Document Management", "Early Childhood Education", "Ecommerce", "Economic Development", "Economics", "Education", "Electrical Engineering", "Electronic Engineering", "Employee Benefits", "Employee Relations", "Energy Engineering", "Engineering Management", "English as a Second Language", "Entrepreneurship", "Environmental Engineering", "Environmental Science", "Equity Research", "Event Planning", "Executive Coaching", "Executive Search", "Fashion Design", "Fashion Merchandising", "Federal Law", "Fiction Writing", "Film Production", "Finance Law", "Financial Analysis", "Financial Services", "Fine Arts", "Fire Science", "Food and Beverage Management", "Food Service", "Foreign Language", "Forensic Science", "Fundraising", "Game Development", "Geology", "Global Health", "Government Relations", "Grant Administration", "Graphic Arts", "Green Energy", "Hardware Engineering", "Health Education", "Healthcare Management", "High School Education", "History", "Home Healthcare", "Hospitality", "Hotel Management", "Human Services", "Illustration", "Industrial Design", "Information Management", "Infrastructure", "Institutional Research", "Insurance Law", "International Business", "International Law", "International Relations", "Investment Management", "IT Consulting", "Jewelry Design", "Journalism and Mass Communication", "Landscape Architecture", "Law Enforcement", "Legal Administration", "Lending", "Library Science", "Life Coaching", "Linguistic Analysis", "Literature", "Logistics Management", "Machine Learning", "Magazine Writing", "Management Consulting", "Manufacturing Engineering", "Market Analysis", "Market Development", "Market Research Analysis", "Marketing Analytics", "Marketing Communications", "Marketing Research", "Materials Science", "Mathematics", "Mechanical Engineering", "Media Relations", "Medical Education", "Medical Imaging", "Medical Records", "Medical Science Liaison", "Medicine", "Meeting Planning", "Mental Health", "Merchandising", "Metallurgy", "Meteorology", "Microbiology", "Military Science", "Mineralogy", "Mining Engineering", "Mobile Development", "Modeling", "Molecular Biology", "Motion Graphics", "Multimedia Design", "Music Composition", "Music Production", "Network Engineering", "Neuroscience", "Nonprofit Management", "Nuclear Engineering", "Nursing", "Nutrition", "Occupational Therapy", "Oceanography", "Office Administration", "Online Marketing", "Operating Systems", "Operations Management", "Optometry", "Organic Chemistry", "Orthopedic Surgery", "Packaging Design", "Paralegal", "Paramedic", "Patent Law", "Pediatric Nursing", "Pediatric Surgery", "Performance Art", "Performing Arts", "Personal Financial Planning", "Personal Training", "Petroleum Engineering", "Pharmaceutical Research", "Pharmacology", "Philosophy", "Photojournalism", "Physical Education", "Physical Therapy", "Physics", "Plumbing", "Podcasting", "Policy Analysis", "Political Campaign Management", "Political Science", "Portfolio Management", "PR Management", "Presentation Design", "Preventive Medicine", "Print Design", "Private Equity", "Probation Officer", "Process Engineering", "Product Design", "Product Management", "Product Marketing", "Production Design", "Professional Development", "Professional Training", "Programming", "Project Management", "Property Management", "Public Health", "Public Policy", "Public Relations", "Public Speaking", "Publishing", "Purchasing", "Quality Assurance", "Quality Control", "Quantitative Analysis", "Radiography", "Real Estate Law", "Real Estate Management", "Recreation", "Recruiting", "Regulatory Affairs", "Rehabilitation", "Religious Studies", "Renewable Energy", "Research", "Restaurant Management", "Retail Management", "Risk Management", "Robotics", "Safety Engineering", "Sales", "Salesforce Administration", "Scenic Design", "School Counseling", "Science Education", "Screenwriting", "Search Engine Optimization", "Security Engineering", "Semiconductor Engineering", "SEO", "Server Administration", "Social Media Marketing", "Social Work", "Sociology", "Software Development", "Software Engineering", "Soil Science", "Special Education", "Sports Medicine", "Statistical Analysis", "Statistics", "Stock Trading", "Strategic Planning", "Structural Engineering", "Supply Chain Management", "Surgery", "Sustainable Agriculture", "Sustainable Design", "Sustainability", "System Administration", "Systems Engineering", "Tax Law", "Tax Preparation", "Teacher Education", "Teaching", "Technical Support", "Technical Writing", "Technology Consulting", "Telecommunications Engineering", "Television Production", "Test Engineering", "Textile Design", "Theater Production", "Theology", "Tourism", "Training and Development", "Transportation Engineering", "Travel Planning", "Urban Planning", "User Experience Design", "UX Design", "Vascular Surgery", "Venture Capital", "Veterinary Medicine", "Video Editing", "Video Production", "Virtual Assistant", "Visual Design", "Vocational Education", "Web Analytics", "Web Design", "Web Development", "Wedding Planning", "Wildlife Biology", "Windows Administration", "Wine Making", "Wireless Networking", "Women's Health", "Workforce Development", "Writing and Editing", "Yoga Instruction", "Youth Ministry", "Zookeeping"};
     this->_job_title_list  = {"Academic Librarian", "Accountant", "Accounting Technician", "Actuary", "Adult Nurse", "Advertising Account executive", "Advertising Account planner", "Advertising Copywriter", "Advice Worker", "Aeronautical Engineer", "Agricultural Consultant", "Agricultural Manager", "Aid Worker/Humanitarian Worker", "Air Traffic Controller", "Airline Cabin Crew", "Amenity Horticulturist", "Analytical Chemist", "Animal Nutritionist", "Animator", "Archaeologist", "Architect", "Architectural Technologist", "Archivist", "Armed Forces Officer", "AromaTherapist", "Art Therapist", "Arts Administrator", "Auditor", "Automotive Engineer", "Barrister", "Barrister's Clerk", "Bid Manager", "Bilingual Secretary", "Biomedical Engineer", "Biomedical Scientist", "Biotechnologist", "Border Force Officer", "Brand Manager", "Broadcasting Presenter", "Building Control Officer/Surveyor", "Building Services Engineer", "Building Surveyor", "Business Analyst", "Camera Operator", "Careers Adviser (Higher Education)", "Careers Adviser", "Careers Consultant", "Cartographer", "Catering Manager", "Charities Administrator", "Charities Fundraiser", "Chemical (Process) Engineer", "Child PsychoTherapist", "Children's Nurse", "Chiropractor", "Civil Engineer", "Civil Service Administrator", "Clinical Biochemist", "Clinical Cytogeneticist", "Clinical Microbiologist", "Clinical Molecular Geneticist", "Clinical Research Associate", "Clinical Scientist", "Clothing Technologist", "Colour Technologist", "Commercial Airline Pilot", "Commercial Horticulturist", "Commercial/Residential Surveyor", "Commissioning Editor", "Commissioning Engineer", "Commodity Broker", "Communications Engineer", "Community Arts Worker", "Community Education Officer", "Community Worker", "Company Secretary", "Computer Sales Support", "Computer Scientist", "Conference Organiser", "Consultant", "Consumer Rights Adviser", "Control and Instrumentation Engineer", "Corporate Banker", "Corporate Treasurer", "Counsellor", "Court Reporter/Verbatim Reporter", "Credit Analyst", "Crown Prosecution Service lawyer", "Crystallographer", "Curator", "Customs Officer", "Cyber Security Specialist", "Dance Movement PsychoTherapist", "Data Analyst", "Data Scientist", "Data Visualisation Analyst", "Database Administrator", "Debt/Dinance Adviser", "Dental Hygienist", "Dentist", "Design Engineer", "Design Manager (Construction)", "DevOps Engineer", "Dietitian", "Diplomatic Service", "Doctor (GP)", "Doctor (Hospital)", "DramaTherapist", "Economist", "Editorial Assistant", "Education Administrator", "Electrical Engineer", "Electronics Engineer", "Employment Advice Worker", "Energy Conservation Officer", "Energy Consultant", "Engineering Geologist", "Environmental Education Officer", "Environmental Health Officer", "Environmental Manager", "Environmental Scientist", "Equal Opportunities Officer", "Equality and Diversity Officer", "Ergonomist", "Estate Agent", "Estimator", "European Commission Administrators", "Exhibition Display Designer", "Exhibition Organiser", "Exploration Geologist", "Facilities Manager", "Field Trials Officer", "Financial Manager", "Fire Engineer", "Firefighter", "Fisheries Enforcement Officer", "Fitness Centre Manager", "Food Scientist", "Food Technologist", "Forensic Scientist", "Freight Forwarder", "Geneticist", "Geographical Information Systems Manager", "Geomatics/Land Surveyor", "Government Lawyer", "Government Research Officer", "Graphic Designer", "Health and Safety Adviser", "Health and Safety Inspector", "Health Promotion Specialist", "Health Service Manager", "Health Visitor", "Herbalist", "Heritage Manager", "Higher Education Administrator", "Higher Education Advice Worker", "Homeless Support Worker", "Horticultural Consultant", "Hotel Manager", "Housing Adviser", "Human Resources Officer", "Hydrologist", "Illustrator", "Immigration Officer", "Immunologist", "Industrial/Product Designer", "Information Scientist", "Information Systems Manager", "Information Technology/Software Trainers", "Insurance Broker", "Insurance Claims Inspector", "Insurance Risk Surveyor", "Insurance Underwriter", "Interpreter", "Investment Analyst", "Investment Banker - Corporate Finance", "Investment Banker - Operations", "Investment FUnd Manager", "IT Consultant", "IT Support Analyst", "Journalist", "Laboratory Technician", "Land-based Engineer", "Landscape Architect", "Learning Disability Nurse", "Learning Mentor", "Lecturer (Adult Education)", "Lecturer (Further Education)", "Lecturer (Higher Education)", "Legal Executive", "Leisure Centre Manager", "Licensed Conveyancer", "Local Government administrator", "Local Government lawyer", "Logistics/Distribution Manager", "Magazine Features Editor", "Magazine Journalist", "Maintenance Engineer", "Management accountant", "Manufacturing Engineer", "Manufacturing Machine Operator", "Manufacturing Toolmaker", "Marine Scientist", "Market Research Analyst", "Market Research Executive", "Marketing Assistant", "Marketing Executive", "Marketing Manager (Direct)", "Marketing Manager (Social Media)", "Materials Engineer", "Materials Specialist", "Mechanical Engineer", "Media Analyst", "Media Buyer", "Media Planner", "Medical Physicist", "Medical Representative", "Mental Health Nurse", "Metallurgist", "Meteorologist", "Microbiologist", "Midwife", "Mining Engineer", "Mobile Developer", "Multimedia Programmer", "Multimedia Specialists", "Museum Education Officer", "Museum/Gallery Exhibition Officer", "Music Therapist", "Nanoscientist", "Nature Conservation Officer", "Naval Architect", "Network Administrator", "Nurse", "Nutritional Therapist", "Nutritionist", "Occupational Therapist", "Oceanographer", "Office Manager", "Operational Researcher", "Orthoptist", "Outdoor Pursuits Manager", "Packaging Technologist", "Paramedic", "Patent Attorney", "Patent Examiner", "Pension Scheme Manager", "Personal Assistant", "Petroleum Engineer", "Pharmacist", "Pharmacologist", "Pharmacovigilance Officer", "Photographer", "PhysioTherapist", "Picture Researcher", "Planning and Development Surveyor", "Planning Technician", "Plant Breeder", "Police Officer", "Political Party Agent", "Political Researcher", "Practice nurse", "Press Photographer", "Press Sub-editor", "Prison Officer", "Private Music Teacher", "Probation Officer", "Product Development Scientist", "Production Manager", "Programme Researcher", "Project Manager", "Psychologist (Clinical)", "Psychologist (Educational)", "PsychoTherapist", "Public Affairs Consultant (Lobbyist)", "Public Affairs Consultant (Research)", "Public House Manager", "Public Librarian", "Public Relations (PR) Officer", "QA Analyst", "Quality Assurance Manager", "Quantity Surveyor", "Records Manager", "Recruitment Consultant", "Recycling Officer", "Regulatory Affairs Officer", "Research Chemist", "Research Scientist", "Restaurant Manager", "Retail Banker", "Retail Buyer", "Retail Manager", "Retail Merchandiser", "Retail Pharmacist", "Sales Executive", "Scene of Crime Officer", "Secretary", "Seismic Interpreter", "Site Engineer", "Site Manager", "Social Researcher", "Social Worker", "Software Developer", "Software Engineer", "Soil Scientist", "Solicitor", "Speech and Language Therapist", "Sports Coach", "Sports Development Officer", "Sports Therapist", "Statistician", "Stockbroker", "Structural Engineer", "Systems Analyst", "Systems Developer", "Tax Inspector", "Teacher (Nursery Years)", "Teacher (Primary)", "Teacher (Secondary)", "Teacher (Special Educational Needs)", "Teaching/Classroom Assistant", "Technical Author", "Technical Sales Engineer", "TEFL/TESL Teacher", "Television Production Assistant", "Test Automation Developer", "Tour Guide", "Tour Operator", "Tour/Holiday Representative", "Tourism Officer", "Tourist Information Manager", "Town and Country Planner", "Toxicologist", "Trade Union Official", "Trade Union Research Officer", "Trader", "Trading Standards Officer", "Training and Development Officer", "Translator", "Transportation Planner", "Travel Agent", "TV/Film/Theatre Set Designer", "UX Designer", "Validation Engineer", "Veterinary Nurse", "Veterinary Surgeon", "Video Game Designer", "Video Game Developer", "Volunteer Work Organiser", "Waste Management Officer", "Water Conservation Officer", "Water Engineer", "Web Designer", "Web Developer", "Welfare Rights Adviser", "Writer", "Youth Worker"};
 
+    ModelDictionary::department_dictionary().seed(this->_department_list);
+    ModelDictionary::job_title_dictionary().seed(this->_job_title_list);
+
+    for (std::size_t index = 0; index < this->_department_list.size(); ++index)
+    {
+        this->_department_code_list[index] = ModelDictionary::department_dictionary().encode(this->_department_list[index]);
+    }
+
+    for (std::size_t index = 0; index < this->_job_title_list.size(); ++index)
+    {
+        this->_job_title_code_list[index] = ModelDictionary::job_title_dictionary().encode(this->_job_title_list[index]);
+    }
+
     this->_generator = std::mt19937(this->_random_device());
 
     this->_first_name_distribution = std::uniform_int_distribution<uint32_t>(0, this->_first_name_list.size() - 1);
@@ -37,7 +50,35 @@ Generator::Generator()
     this->_sex_distribution        = std::uniform_int_distribution<uint16_t>(0, 1);
 }
 
-Model Generator::model_generator()
+Model Generator::model_generator(std::pmr::memory_resource* resource)
+{
+    std::uint16_t department;
+    std::uint16_t job_title;
+
+    ModelDate employment_date = this->generate_row(department, job_title);
+
+    Model model{Model::allocator_type(resource)};
+    model.set_model(this->_name_buffer, department, job_title, employment_date);
+
+    return model;
+}
+
+void Generator::generate_batch(ModelBatch& batch, std::size_t amount)
+{
+    std::uint16_t department;
+    std::uint16_t job_title;
+
+    batch.reserve(batch.size() + amount);
+
+    for (std::size_t index = 0; index < amount; ++index)
+    {
+        ModelDate employment_date = this->generate_row(department, job_title);
+
+        batch.append(this->_name_buffer, department, job_title, employment_date);
+    }
+}
+
+ModelDate Generator::generate_row(std::uint16_t& department, std::uint16_t& job_title)
 {
     uint16_t year = this->_year_distribution(this->_generator);
     uint16_t month = this->_month_distribution(this->_generator);
@@ -50,11 +91,16 @@ Model Generator::model_generator()
 
     day = this->_day_distribution(this->_generator);
 
-    std::string full_name  = std::string(this->_first_name_list.at(this->_first_name_distribution(this->_generator))) + " " + std::string(this->_last_name_list.at(this->_last_name_distribution(this->_generator))) + " " + std::string(this->_first_name_list.at(this->_first_name_distribution(this->_generator))) + ((this->_sex_distribution(this->_generator)) ? "ovich" : "ovna");
-    std::string department = std::string(this->_department_list.at(this->_department_distribution(this->_generator)));
-    std::string job_title  = std::string(this->_job_title_list.at(this->_job_title_distribution(this->_generator)));
+    this->_name_buffer.clear();
+    this->_name_buffer.append(this->_first_name_list.at(this->_first_name_distribution(this->_generator))).append(" ");
+    this->_name_buffer.append(this->_last_name_list.at(this->_last_name_distribution(this->_generator))).append(" ");
+    this->_name_buffer.append(this->_first_name_list.at(this->_first_name_distribution(this->_generator)));
+    this->_name_buffer.append((this->_sex_distribution(this->_generator)) ? "ovich" : "ovna");
+
+    department = this->_department_code_list[this->_department_distribution(this->_generator)];
+    job_title  = this->_job_title_code_list[this->_job_title_distribution(this->_generator)];
 
-    return Model(full_name, department, job_title, std::chrono::year_month_day{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}});
+    return std::chrono::year_month_day{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
 }
 
 Generator::~Generator()
@@ -29,6 +29,10 @@
 #include "../model/model.hpp"
 #endif // MODEL_HPP
 
+#ifndef MODEL_BATCH_HPP
+#include "../model/model_batch.hpp"
+#endif // MODEL_BATCH_HPP
+
 /**
  * @class Generator
  * @brief A class that generates models.
@@ -66,14 +70,45 @@ public:
      * last name, department, job title, and date of birth. The date of birth is
      * within a certain range of years, and the other attributes are randomly
      * selected from the predefined lists.
+     *
+     * @param resource The memory resource for the full name of the model.
+     */
+    Model model_generator(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Generates many models straight into a batch.
+     *
+     * Rows are drawn exactly like model_generator() draws them, but no Model object
+     * is ever constructed: the dictionary codes, the packed date and the assembled
+     * name go directly into the batch columns.
+     *
+     * @param batch The batch to append the rows to.
+     * @param amount The number of rows to generate.
      */
-    Model model_generator();
+    void generate_batch(ModelBatch& batch, std::size_t amount);
 
 private:
+    /**
+     * @brief Draws the fields of one random row.
+     *
+     * The full name is assembled in _name_buffer.
+     *
+     * @param department Receives the department code.
+     * @param job_title Receives the job title code.
+     *
+     * @return The employment date.
+     */
+    ModelDate generate_row(std::uint16_t& department, std::uint16_t& job_title);
+
     std::array<std::string, 2738> _first_name_list; /**< The list of first names. */
     std::array<std::string, 1000> _last_name_list;  /**< The list of last names. */
     std::array<std::string, 449> _department_list;  /**< The list of departments. */
     std::array<std::string, 357> _job_title_list;   /**< The list of job titles. */
+
+    std::array<std::uint16_t, 449> _department_code_list;   /**< Dictionary codes of the departments. */
+    std::array<std::uint16_t, 357> _job_title_code_list;    /**< Dictionary codes of the job titles. */
+
+    std::string _name_buffer;   /**< Scratch buffer the full names are assembled in. */
     
     std::random_device       _random_device;        /**< The random number generator device. */
     std::mt19937             _generator;            /**< The random number generator. */
@@ -0,0 +1,205 @@
+/**
+ * @file       <bloom_filter.cpp>
+ * @brief      This source file holds implementation of BloomFilter class.
+ *
+ *             This calss implements blocked Bloom filter placed in front of hash lookups.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+BloomFilter::BloomFilter()
+{
+    this->_hash_count = 1;
+    this->_size = 0;
+    this->_false_positive_rate = 1.0;
+}
+
+/**
+ * Picks the smallest size, in steps of a quarter bit per key, and the number of bits set
+ * per key for which expected_rate() meets the target.
+ */
+BloomFilter::BloomFilter(std::size_t entries, double false_positive_rate) : BloomFilter()
+{
+    if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+    {
+        throw std::invalid_argument("false positive rate should be in (0, 1)");
+    }
+
+    double bits_per_key = std::max(1.0, std::log2(1.0 / false_positive_rate) / std::log(2.0));
+
+    while (true)
+    {
+        std::uint32_t best_count = 1;
+        double best_rate = 1.0;
+
+        for (std::uint32_t hash_count = 1; hash_count <= BloomFilter::max_hash_count; ++hash_count)
+        {
+            double rate = BloomFilter::expected_rate(bits_per_key, hash_count);
+
+            if (rate < best_rate)
+            {
+                best_rate = rate;
+                best_count = hash_count;
+            }
+        }
+
+        if (best_rate <= false_positive_rate || bits_per_key >= 64.0)
+        {
+            this->_hash_count = best_count;
+            break;
+        }
+
+        bits_per_key += 0.25;
+    }
+
+    std::size_t bits = static_cast<std::size_t>(std::ceil(bits_per_key * static_cast<double>(std::max<std::size_t>(1, entries))));
+
+    this->_blocks.assign((bits + BloomFilter::block_bits - 1) / BloomFilter::block_bits, Block{});
+    this->_false_positive_rate = false_positive_rate;
+}
+
+BloomFilter::~BloomFilter()
+{
+    return;
+}
+
+void BloomFilter::insert(std::uint32_t hash)
+{
+    if (this->_blocks.empty())
+    {
+        this->_blocks.assign(1, Block{});
+    }
+
+    std::uint64_t mixed = BloomFilter::mix_hash(hash);
+    Block& block = this->_blocks[((mixed >> 32) * this->_blocks.size()) >> 32];
+
+    for (std::uint32_t index = 0; index < this->_hash_count; ++index)
+    {
+        std::uint32_t bit = (static_cast<std::uint32_t>(mixed) * BloomFilter::salts[index]) >> 23;
+
+        block.words[bit >> 6] |= std::uint64_t{1} << (bit & 63);
+    }
+
+    ++this->_size;
+}
+
+bool BloomFilter::may_contain(std::uint32_t hash) const
+{
+    if (this->_blocks.empty())
+    {
+        return false;
+    }
+
+    std::uint64_t mixed = BloomFilter::mix_hash(hash);
+    const Block& block = this->_blocks[((mixed >> 32) * this->_blocks.size()) >> 32];
+
+    for (std::uint32_t index = 0; index < this->_hash_count; ++index)
+    {
+        std::uint32_t bit = (static_cast<std::uint32_t>(mixed) * BloomFilter::salts[index]) >> 23;
+
+        if ((block.words[bit >> 6] & (std::uint64_t{1} << (bit & 63))) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t BloomFilter::size() const
+{
+    return this->_size;
+}
+
+std::size_t BloomFilter::bytes() const
+{
+    return this->_blocks.size() * sizeof(Block);
+}
+
+double BloomFilter::bits_per_key() const
+{
+    return (this->_size == 0) ? 0.0 : static_cast<double>(this->bytes() * 8) / this->_size;
+}
+
+std::size_t BloomFilter::hash_count() const
+{
+    return this->_hash_count;
+}
+
+double BloomFilter::false_positive_rate() const
+{
+    return this->_false_positive_rate;
+}
+
+double BloomFilter::expected_false_positive_rate() const
+{
+    if (this->_size == 0)
+    {
+        return 0.0;
+    }
+
+    return BloomFilter::expected_rate(this->bits_per_key(), this->_hash_count);
+}
+
+/**
+ * The number of keys in the block of a query is Poisson distributed around the mean
+ * block load, and a block holding j keys answers wrongly with the plain Bloom filter
+ * rate of a 512-bit filter with j keys.
+ */
+double BloomFilter::expected_rate(double bits_per_key, std::uint32_t hash_count)
+{
+    double load = BloomFilter::block_bits / bits_per_key;
+    double probability = std::exp(-load);
+    double rate = 0.0;
+    std::size_t limit = static_cast<std::size_t>(load + 10.0 * std::sqrt(load) + 20.0);
+
+    for (std::size_t keys = 0; keys <= limit; ++keys)
+    {
+        double zero_bit = std::pow(1.0 - 1.0 / BloomFilter::block_bits, static_cast<double>(hash_count * keys));
+
+        rate += probability * std::pow(1.0 - zero_bit, hash_count);
+        probability *= load / static_cast<double>(keys + 1);
+    }
+
+    return rate;
+}
+
+BloomFilter BloomFilter::hash_model(const std::vector<Model>& model_vector, double false_positive_rate)
+{
+    BloomFilter filter(model_vector.size(), false_positive_rate);
+
+    for (const Model& model : model_vector)
+    {
+        filter.insert(model.get_hash());
+    }
+    return filter;
+}
+
+BloomFilter BloomFilter::hash_model(const ModelTable& model_table, double false_positive_rate)
+{
+    const std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    BloomFilter filter(hash_column.size(), false_positive_rate);
+
+    for (std::uint32_t hash : hash_column)
+    {
+        filter.insert(hash);
+    }
+    return filter;
+}
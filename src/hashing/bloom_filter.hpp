@@ -0,0 +1,211 @@
+/**
+ * @file       <bloom_filter.hpp>
+ * @brief      This header file holds implementation of BloomFilter class.
+ *
+ *             This calss implements blocked Bloom filter placed in front of hash lookups.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef BLOOM_FILTER_HPP
+#define BLOOM_FILTER_HPP
+
+#ifndef MODEL_HPP
+#include "../model/model.hpp"
+#endif // MODEL_HPP
+
+#ifndef MODEL_TABLE_HPP
+#include "../model/model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BloomFilter
+ * @brief Blocked Bloom filter over 32-bit key hashes.
+ *
+ * All bits of a key fall into one 64-byte block picked by the key hash, so answering
+ * a query reads a single cache line. A negative answer is exact, so lookups of absent
+ * keys can skip the hash table entirely; a positive one is wrong with about the
+ * configured false positive rate and has to be confirmed by the table.
+ *
+ * The filter works on the same hashes as the tables it guards, so keys whose hashes
+ * collide with a present key are always reported as present.
+ */
+class BloomFilter
+{
+public:
+    /**
+     * @brief Constructor for the BloomFilter class, the filter holds no keys.
+     */
+    BloomFilter();
+
+    /**
+     * @brief Constructor for the BloomFilter class.
+     *
+     * @param entries The number of keys the filter is sized for.
+     * @param false_positive_rate The target false positive rate at that size.
+     *
+     * @throws std::invalid_argument If the rate is not in (0, 1).
+     */
+    BloomFilter(std::size_t entries, double false_positive_rate);
+
+    /**
+     * @brief Destructor for the BloomFilter class.
+     */
+    ~BloomFilter();
+
+    /**
+     * @brief Copy constructor for the BloomFilter class.
+     *
+     * @param other The other BloomFilter to be copied.
+     */
+    BloomFilter(const BloomFilter& other) = default;
+
+    /**
+     * @brief Move constructor for the BloomFilter class.
+     *
+     * @param other The other BloomFilter to be moved from.
+     */
+    BloomFilter(BloomFilter&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the BloomFilter class.
+     *
+     * @param other The other BloomFilter to be copied.
+     *
+     * @return Reference to this BloomFilter.
+     */
+    BloomFilter& operator= (const BloomFilter& other) = default;
+
+    /**
+     * @brief Move assignment operator for the BloomFilter class.
+     *
+     * @param other The other BloomFilter to be moved from.
+     *
+     * @return Reference to this BloomFilter.
+     */
+    BloomFilter& operator= (BloomFilter&& other) noexcept = default;
+
+    /**
+     * @brief Adds a key to the filter.
+     *
+     * @param hash The hash of the key.
+     */
+    void insert(std::uint32_t hash);
+
+    /**
+     * @brief Checks whether a key may be present.
+     *
+     * @param hash The hash of the key.
+     *
+     * @return False if the key was never inserted, true if it may have been.
+     */
+    bool may_contain(std::uint32_t hash) const;
+
+    /**
+     * @brief Gets the number of inserted keys.
+     *
+     * @return The number of keys.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the memory taken by the filter bits.
+     *
+     * @return The number of bytes.
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Gets the number of filter bits per inserted key.
+     *
+     * @return The bits per key.
+     */
+    double bits_per_key() const;
+
+    /**
+     * @brief Gets the number of bits set per key.
+     *
+     * @return The number of bits.
+     */
+    std::size_t hash_count() const;
+
+    /**
+     * @brief Gets the false positive rate the filter was sized for.
+     *
+     * @return The target false positive rate.
+     */
+    double false_positive_rate() const;
+
+    /**
+     * @brief Estimates the false positive rate at the current number of keys.
+     *
+     * @return The expected false positive rate.
+     */
+    double expected_false_positive_rate() const;
+
+    /**
+     * @brief Builds a filter from the hashes the models got from Hashing::hash_model.
+     *
+     * @param model_vector The hashed model vector.
+     * @param false_positive_rate The target false positive rate.
+     *
+     * @return The filter.
+     */
+    static BloomFilter hash_model(const std::vector<Model>& model_vector, double false_positive_rate);
+
+    /**
+     * @brief Builds a filter from the hash column filled by Hashing::hash_rows.
+     *
+     * @param model_table The hashed model table.
+     * @param false_positive_rate The target false positive rate.
+     *
+     * @return The filter.
+     */
+    static BloomFilter hash_model(const ModelTable& model_table, double false_positive_rate);
+
+private:
+    struct alignas(64) Block
+    {
+        std::uint64_t   words[8];
+    };
+
+    static constexpr std::uint32_t block_bits = 512;
+    static constexpr std::uint32_t max_hash_count = 16;
+    static constexpr std::uint32_t salts[max_hash_count] =
+    {
+        0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u,
+        0x8A3C3FD3u, 0x3C5C1B8Du, 0xC3B5A56Bu, 0x6E0D5C2Fu, 0xB7E15163u, 0x9B1F7E45u, 0xD1B54A33u, 0x1D8E4E27u,
+    };
+
+    /**
+     * @brief Spreads the key hash, the upper half picks the block and the lower half the bits.
+     */
+    static std::uint64_t mix_hash(std::uint32_t hash)
+    {
+        std::uint64_t mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+
+        return mixed ^ (mixed >> 29);
+    }
+
+    static double expected_rate(double bits_per_key, std::uint32_t hash_count);
+
+    std::vector<Block>  _blocks;
+    std::uint32_t       _hash_count;
+    std::size_t         _size;
+    double              _false_positive_rate;
+};
+
+#endif // BLOOM_FILTER_HPP
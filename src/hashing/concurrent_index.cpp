@@ -0,0 +1,242 @@
+/**
+ * @file       <concurrent_index.cpp>
+ * @brief      This source file holds implementation of ConcurrentHashIndex class.
+ *
+ *             This calss implements a hash index of row indices that is read by many threads without locks.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "concurrent_index.hpp"
+
+#include <bit>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+ConcurrentHashIndex::ConcurrentHashIndex(std::size_t size)
+{
+    std::size_t capacity = ConcurrentHashIndex::min_capacity;
+
+    while (capacity / 2 < size)
+    {
+        capacity *= 2;
+    }
+
+    this->_table.store(ConcurrentHashIndex::make_table(capacity).release());
+    this->_size.store(0);
+    this->_epoch.store(0);
+}
+
+ConcurrentHashIndex::~ConcurrentHashIndex()
+{
+    delete this->_table.load();
+    return;
+}
+
+ConcurrentHashIndex::ReadGuard::ReadGuard(const ConcurrentHashIndex& index)
+{
+    std::size_t parity = static_cast<std::size_t>(index._epoch.load(std::memory_order_seq_cst) & 1);
+
+    this->_counter = &index._readers[ConcurrentHashIndex::reader_stripe()].active[parity];
+    this->_counter->fetch_add(1, std::memory_order_seq_cst);
+}
+
+ConcurrentHashIndex::ReadGuard::~ReadGuard()
+{
+    this->_counter->fetch_sub(1, std::memory_order_release);
+    return;
+}
+
+void ConcurrentHashIndex::reserve(std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(this->_writer);
+
+    std::size_t capacity = this->_table.load(std::memory_order_relaxed)->capacity;
+
+    while (capacity / 2 < size)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > this->_table.load(std::memory_order_relaxed)->capacity)
+    {
+        this->rehash(capacity);
+    }
+}
+
+void ConcurrentHashIndex::insert(std::uint32_t hash, std::uint32_t row)
+{
+    if (row == std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::invalid_argument("row should be less than UINT32_MAX");
+    }
+
+    std::lock_guard<std::mutex> lock(this->_writer);
+
+    Table* table = this->_table.load(std::memory_order_relaxed);
+    std::size_t size = this->_size.load(std::memory_order_relaxed);
+
+    if (size + 1 > table->capacity / 2)
+    {
+        this->rehash(table->capacity * 2);
+        table = this->_table.load(std::memory_order_relaxed);
+    }
+
+    ConcurrentHashIndex::emplace(*table, (static_cast<std::uint64_t>(row) << 32) | hash);
+    this->_size.store(size + 1, std::memory_order_release);
+}
+
+std::optional<std::uint32_t> ConcurrentHashIndex::find(std::uint32_t hash) const
+{
+    return this->find(hash, [](std::uint32_t)
+    {
+        return true;
+    });
+}
+
+std::size_t ConcurrentHashIndex::size() const
+{
+    return this->_size.load(std::memory_order_acquire);
+}
+
+std::size_t ConcurrentHashIndex::capacity() const
+{
+    ReadGuard guard(*this);
+
+    return this->_table.load(std::memory_order_seq_cst)->capacity;
+}
+
+HashStatistics ConcurrentHashIndex::statistics() const
+{
+    ReadGuard guard(*this);
+
+    const Table* table = this->_table.load(std::memory_order_seq_cst);
+    std::size_t mask = table->capacity - 1;
+
+    HashStatistics statistics;
+
+    statistics.layout = "concurrent";
+    statistics.buckets = table->capacity;
+    statistics.bytes = table->capacity * sizeof(std::uint64_t);
+
+    for (std::size_t index = 0; index < table->capacity; ++index)
+    {
+        std::uint64_t entry = table->slots[index].load(std::memory_order_acquire);
+
+        if (entry == ConcurrentHashIndex::empty_slot)
+        {
+            ++statistics.empty_buckets;
+            continue;
+        }
+
+        ++statistics.entries;
+        statistics.record_probe((index - ConcurrentHashIndex::home(*table, static_cast<std::uint32_t>(entry))) & mask);
+    }
+    return statistics;
+}
+
+/**
+ * Threads are given stripes round-robin the first time they read any index, so up to
+ * reader_stripes threads each get a cache line of their own.
+ */
+std::size_t ConcurrentHashIndex::reader_stripe()
+{
+    static std::atomic<std::size_t> next_stripe{0};
+    thread_local std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % ConcurrentHashIndex::reader_stripes;
+
+    return stripe;
+}
+
+std::unique_ptr<ConcurrentHashIndex::Table> ConcurrentHashIndex::make_table(std::size_t capacity)
+{
+    std::unique_ptr<Table> table = std::make_unique<Table>();
+
+    table->capacity = capacity;
+    table->shift = 64 - static_cast<unsigned int>(std::countr_zero(capacity));
+    table->slots = std::make_unique<std::atomic<std::uint64_t>[]>(capacity);
+
+    for (std::size_t index = 0; index < capacity; ++index)
+    {
+        table->slots[index].store(ConcurrentHashIndex::empty_slot, std::memory_order_relaxed);
+    }
+    return table;
+}
+
+void ConcurrentHashIndex::emplace(Table& table, std::uint64_t entry)
+{
+    std::size_t mask = table.capacity - 1;
+    std::size_t index = ConcurrentHashIndex::home(table, static_cast<std::uint32_t>(entry));
+
+    while (table.slots[index].load(std::memory_order_relaxed) != ConcurrentHashIndex::empty_slot)
+    {
+        index = (index + 1) & mask;
+    }
+
+    table.slots[index].store(entry, std::memory_order_release);
+}
+
+/**
+ * A reader that can still hold the old table incremented one of the counters of its
+ * stripe before the new table was published, and keeps it up until it leaves. Every
+ * counter is seen at zero at least once after the publication, so every such reader
+ * has left. The first flip sends new readers to the other parity so the counter being
+ * waited for only drains, the second does the same for the other one.
+ *
+ * A reader preempted inside a lookup keeps its counter up, so after a few yields the
+ * writer sleeps instead, which lets it run even when every core is busy reading.
+ */
+void ConcurrentHashIndex::synchronize() const
+{
+    for (std::size_t flip = 0; flip < 2; ++flip)
+    {
+        std::size_t parity = static_cast<std::size_t>(this->_epoch.fetch_add(1, std::memory_order_seq_cst) & 1);
+
+        for (const ReaderStripe& stripe : this->_readers)
+        {
+            for (std::size_t attempt = 0; stripe.active[parity].load(std::memory_order_seq_cst) != 0; ++attempt)
+            {
+                if (attempt < ConcurrentHashIndex::yield_attempts)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        }
+    }
+}
+
+void ConcurrentHashIndex::rehash(std::size_t capacity)
+{
+    Table* old_table = this->_table.load(std::memory_order_relaxed);
+    std::unique_ptr<Table> new_table = ConcurrentHashIndex::make_table(capacity);
+
+    for (std::size_t index = 0; index < old_table->capacity; ++index)
+    {
+        std::uint64_t entry = old_table->slots[index].load(std::memory_order_relaxed);
+
+        if (entry != ConcurrentHashIndex::empty_slot)
+        {
+            ConcurrentHashIndex::emplace(*new_table, entry);
+        }
+    }
+
+    this->_table.store(new_table.release(), std::memory_order_seq_cst);
+    this->synchronize();
+
+    delete old_table;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file       <concurrent_index.hpp>
+ * @brief      This header file holds implementation of ConcurrentHashIndex class.
+ *
+ *             This calss implements a hash index of row indices that is read by many threads without locks.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef CONCURRENT_INDEX_HPP
+#define CONCURRENT_INDEX_HPP
+
+#ifndef HASH_STATISTICS_HPP
+#include "hash_statistics.hpp"
+#endif // HASH_STATISTICS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+/**
+ * @class ConcurrentHashIndex
+ * @brief Linear-probing hash index of row indices with lock-free lookups.
+ *
+ * A slot is a single 64-bit word holding the 32-bit hash and the 32-bit row, so a
+ * reader sees either an empty slot or a complete entry, never half of one. Slots only
+ * ever go from empty to full, which lets lookups probe the table while a writer fills
+ * it.
+ *
+ * Writers take a mutex. Growth copies the entries into a table twice as large and
+ * publishes it with one pointer store; readers that already hold the old table finish
+ * on it. The old table is freed once no reader can still be inside it.
+ *
+ * That grace period is tracked with read-side counters (sleepable RCU style). A
+ * reader increments the counter of the current epoch parity on entry and decrements
+ * it on exit. The writer flips the epoch twice and waits for the counter of the
+ * parity it left to drain each time. The counters are striped over cache lines by
+ * thread, so readers on different cores never write to the same line.
+ */
+class ConcurrentHashIndex
+{
+public:
+    /**
+     * @brief Constructor for the ConcurrentHashIndex class.
+     *
+     * @param size The number of rows the index should hold without growing.
+     */
+    explicit ConcurrentHashIndex(std::size_t size = 0);
+
+    /**
+     * @brief Destructor for the ConcurrentHashIndex class.
+     *
+     * No thread may use the index while it is destroyed.
+     */
+    ~ConcurrentHashIndex();
+
+    ConcurrentHashIndex(const ConcurrentHashIndex&) = delete;
+    ConcurrentHashIndex& operator=(const ConcurrentHashIndex&) = delete;
+
+    /**
+     * @brief Makes room for the given number of rows.
+     *
+     * @param size The number of rows the index should hold without growing.
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * @brief Adds a row to the index, safe to call from several threads.
+     *
+     * The row is visible to every lookup that starts after this returns.
+     *
+     * @param hash The hash of the row key.
+     * @param row The row index.
+     *
+     * @throws std::invalid_argument If the row is the reserved value UINT32_MAX.
+     */
+    void insert(std::uint32_t hash, std::uint32_t row);
+
+    /**
+     * @brief Finds a row inserted with the given hash, without taking a lock.
+     *
+     * Same contract as HashIndex::find: only the hash is compared.
+     *
+     * @param hash The hash value.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    std::optional<std::uint32_t> find(std::uint32_t hash) const;
+
+    /**
+     * @brief Finds a row with the given hash that satisfies a predicate, without taking a lock.
+     *
+     * @tparam Predicate Callable taking a row index and returning bool.
+     * @param hash The hash value.
+     * @param predicate The predicate, only called for rows with the same hash.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    template<typename Predicate>
+        std::optional<std::uint32_t> find(std::uint32_t hash, Predicate&& predicate) const;
+
+    /**
+     * @brief Gets the number of rows in the index.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of slots of the current table.
+     *
+     * @return The number of slots.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Gathers occupancy and probe statistics of the current table.
+     *
+     * @return The statistics.
+     */
+    HashStatistics statistics() const;
+
+private:
+    struct Table
+    {
+        std::size_t                                 capacity;
+        unsigned int                                shift;      ///< 64 - log2(capacity), turns a mixed hash into a home slot.
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+    };
+
+    struct alignas(64) ReaderStripe
+    {
+        std::atomic<std::int64_t>   active[2];  ///< Readers inside the index that entered in an even or odd epoch.
+    };
+
+    /**
+     * @brief Marks the calling thread as reading the index for its lifetime.
+     */
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const ConcurrentHashIndex& index);
+        ~ReadGuard();
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        std::atomic<std::int64_t>*  _counter;
+    };
+
+    static constexpr std::uint64_t empty_slot = ~std::uint64_t{0};
+    static constexpr std::size_t reader_stripes = 64;
+    static constexpr std::size_t min_capacity = 16;
+    static constexpr std::size_t yield_attempts = 64;      ///< Yields before a writer waiting for readers starts sleeping.
+
+    static std::size_t home(const Table& table, std::uint32_t hash)
+    {
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> table.shift);
+    }
+
+    /**
+     * @brief The stripe of read-side counters used by the calling thread.
+     */
+    static std::size_t reader_stripe();
+
+    static std::unique_ptr<Table> make_table(std::size_t capacity);
+
+    /**
+     * @brief Stores an entry into a table, the caller holds the writer mutex.
+     */
+    static void emplace(Table& table, std::uint64_t entry);
+
+    /**
+     * @brief Waits until no reader can hold a table unpublished before the call.
+     */
+    void synchronize() const;
+
+    /**
+     * @brief Replaces the current table with a larger one, the caller holds the writer mutex.
+     */
+    void rehash(std::size_t capacity);
+
+    std::atomic<Table*>                             _table;
+    std::atomic<std::size_t>                        _size;
+    mutable std::atomic<std::uint64_t>              _epoch;
+    mutable std::array<ReaderStripe, reader_stripes> _readers;
+    std::mutex                                      _writer;
+};
+
+template<typename Predicate>
+std::optional<std::uint32_t> ConcurrentHashIndex::find(std::uint32_t hash, Predicate&& predicate) const
+{
+    ReadGuard guard(*this);
+
+    const Table* table = this->_table.load(std::memory_order_seq_cst);
+    std::size_t mask = table->capacity - 1;
+
+    for (std::size_t index = ConcurrentHashIndex::home(*table, hash); ; index = (index + 1) & mask)
+    {
+        std::uint64_t entry = table->slots[index].load(std::memory_order_acquire);
+
+        if (entry == ConcurrentHashIndex::empty_slot)
+        {
+            return std::nullopt;
+        }
+
+        if (static_cast<std::uint32_t>(entry) == hash && predicate(static_cast<std::uint32_t>(entry >> 32)))
+        {
+            return static_cast<std::uint32_t>(entry >> 32);
+        }
+    }
+}
+
+#endif // CONCURRENT_INDEX_HPP
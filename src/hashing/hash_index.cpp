@@ -0,0 +1,416 @@
+/**
+ * @file       <hash_index.cpp>
+ * @brief      This source file holds implementation of HashIndex class.
+ *
+ *             This calss implements flat open-addressing hash index over model rows.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "hash_index.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+HashIndex::HashIndex()
+{
+    this->_migrated = 0;
+    this->_migrate_stride = 1;
+    this->_size = 0;
+    this->_max_load_factor = 0.875;
+}
+
+HashIndex::HashIndex(std::size_t size) : HashIndex()
+{
+    this->reserve(size);
+}
+
+HashIndex::~HashIndex()
+{
+    return;
+}
+
+void HashIndex::reserve(std::size_t size)
+{
+    std::size_t capacity = HashIndex::group_size;
+
+    while (this->max_load(capacity) < size)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > this->capacity())
+    {
+        this->rehash(capacity);
+    }
+}
+
+void HashIndex::insert(std::uint32_t hash, std::uint32_t row)
+{
+    if (this->resizing())
+    {
+        this->migrate(this->_migrate_stride);
+    }
+
+    if (this->_table.growth_left == 0)
+    {
+        this->grow();
+    }
+
+    HashIndex::emplace(this->_table, hash, row);
+    ++this->_size;
+}
+
+bool HashIndex::erase(std::uint32_t hash, std::uint32_t row)
+{
+    if (this->resizing())
+    {
+        this->migrate(this->_migrate_stride);
+    }
+
+    auto same_row = [row](std::uint32_t candidate)
+    {
+        return candidate == row;
+    };
+
+    std::optional<std::size_t> slot = HashIndex::find_slot(this->_table, hash, same_row);
+
+    if (slot.has_value())
+    {
+        std::size_t offset = slot.value() - slot.value() % ControlGroup::width;
+
+        // Probing is group-aligned, so a group that still has an empty slot ends every
+        // probe passing through it and the erased slot can become empty again.
+        if (ControlGroup(this->_table.control.data() + offset).match_empty() != 0)
+        {
+            this->_table.control[slot.value()] = HashIndex::empty_control;
+            ++this->_table.growth_left;
+        }
+        else
+        {
+            this->_table.control[slot.value()] = HashIndex::deleted_control;
+        }
+
+        --this->_size;
+        return true;
+    }
+
+    slot = HashIndex::find_slot(this->_old, hash, same_row);
+
+    if (slot.has_value())
+    {
+        this->_old.control[slot.value()] = HashIndex::deleted_control;
+
+        --this->_size;
+        return true;
+    }
+
+    return false;
+}
+
+bool HashIndex::update(std::uint32_t old_hash, std::uint32_t new_hash, std::uint32_t row)
+{
+    if (!this->erase(old_hash, row))
+    {
+        return false;
+    }
+
+    this->insert(new_hash, row);
+    return true;
+}
+
+std::optional<std::uint32_t> HashIndex::find(std::uint32_t hash) const
+{
+    return this->find(hash, [](std::uint32_t)
+    {
+        return true;
+    });
+}
+
+/**
+ * Works in blocks of batch_size hashes and three passes per block. The first pass
+ * prefetches the home control group of every hash, the second one matches the
+ * fingerprints against the now cached groups and prefetches the first matching slot,
+ * the last one probes as find(hash) does, mostly hitting the cache.
+ */
+void HashIndex::find_many(std::span<const std::uint32_t> hashes, std::span<std::optional<std::uint32_t>> results) const
+{
+    if (results.size() < hashes.size())
+    {
+        throw std::invalid_argument("results should hold a result for every hash");
+    }
+
+    if (this->_table.control.empty())
+    {
+        for (std::size_t index = 0; index < hashes.size(); ++index)
+        {
+            results[index] = this->find(hashes[index]);
+        }
+        return;
+    }
+
+    std::size_t group_mask = this->_table.control.size() / ControlGroup::width - 1;
+    std::size_t offsets[HashIndex::batch_size];
+
+    for (std::size_t begin = 0; begin < hashes.size(); begin += HashIndex::batch_size)
+    {
+        std::size_t end = std::min(hashes.size(), begin + HashIndex::batch_size);
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            offsets[index - begin] = (static_cast<std::size_t>(HashIndex::mix_hash(hashes[index]) >> 32) & group_mask) * ControlGroup::width;
+            HashIndex::prefetch_address(this->_table.control.data() + offsets[index - begin]);
+        }
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            auto mask = ControlGroup(this->_table.control.data() + offsets[index - begin]).match(HashIndex::fingerprint(HashIndex::mix_hash(hashes[index])));
+
+            if (mask != 0)
+            {
+                HashIndex::prefetch_address(this->_table.slots.data() + offsets[index - begin] + (std::countr_zero(mask) >> ControlGroup::shift));
+            }
+        }
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            results[index] = this->find(hashes[index]);
+        }
+    }
+}
+
+std::vector<std::optional<std::uint32_t>> HashIndex::find_many(std::span<const std::uint32_t> hashes) const
+{
+    std::vector<std::optional<std::uint32_t>> results(hashes.size());
+
+    this->find_many(hashes, results);
+
+    return results;
+}
+
+std::size_t HashIndex::size() const
+{
+    return this->_size;
+}
+
+std::size_t HashIndex::capacity() const
+{
+    return this->_table.control.size();
+}
+
+bool HashIndex::resizing() const
+{
+    return !this->_old.control.empty();
+}
+
+double HashIndex::max_load_factor() const
+{
+    return this->_max_load_factor;
+}
+
+void HashIndex::max_load_factor(double load_factor)
+{
+    if (!(load_factor >= 0.25 && load_factor <= 0.9375))
+    {
+        throw std::invalid_argument("max load factor should be in [0.25, 0.9375]");
+    }
+
+    this->_max_load_factor = load_factor;
+}
+
+void HashIndex::clear()
+{
+    std::fill(this->_table.control.begin(), this->_table.control.end(), HashIndex::empty_control);
+
+    this->_old = Table();
+    this->_migrated = 0;
+    this->_size = 0;
+    this->_table.growth_left = this->max_load(this->capacity());
+}
+
+HashStatistics HashIndex::statistics() const
+{
+    HashStatistics statistics;
+
+    statistics.layout = "flat";
+
+    HashIndex::table_statistics(this->_table, statistics);
+    HashIndex::table_statistics(this->_old, statistics);
+
+    return statistics;
+}
+
+void HashIndex::emplace(Table& table, std::uint32_t hash, std::uint32_t row)
+{
+    std::uint64_t mixed = HashIndex::mix_hash(hash);
+    std::size_t group_mask = table.control.size() / ControlGroup::width - 1;
+    std::size_t group = static_cast<std::size_t>(mixed >> 32) & group_mask;
+
+    for (std::size_t step = 1; ; ++step)
+    {
+        std::size_t offset = group * ControlGroup::width;
+        auto mask = ControlGroup(table.control.data() + offset).match_free();
+
+        if (mask != 0)
+        {
+            std::size_t index = offset + (std::countr_zero(mask) >> ControlGroup::shift);
+
+            if (table.control[index] == HashIndex::empty_control)
+            {
+                --table.growth_left;
+            }
+
+            table.control[index] = HashIndex::fingerprint(mixed);
+            table.slots[index] = Slot{hash, row};
+            return;
+        }
+
+        group = (group + step) & group_mask;
+    }
+}
+
+/**
+ * @brief Adds the slots of a table, following the probe sequence of every full slot from
+ * its home group to find its distance.
+ */
+void HashIndex::table_statistics(const Table& table, HashStatistics& statistics)
+{
+    std::size_t group_mask = table.control.size() / ControlGroup::width - 1;
+
+    for (std::size_t index = 0; index < table.control.size(); ++index)
+    {
+        if (table.control[index] == HashIndex::empty_control)
+        {
+            ++statistics.empty_buckets;
+            continue;
+        }
+
+        if (table.control[index] == HashIndex::deleted_control)
+        {
+            ++statistics.deleted;
+            continue;
+        }
+
+        std::size_t group = static_cast<std::size_t>(HashIndex::mix_hash(table.slots[index].hash) >> 32) & group_mask;
+        std::size_t distance = 0;
+
+        while (group != index / ControlGroup::width)
+        {
+            ++distance;
+            group = (group + distance) & group_mask;
+        }
+
+        statistics.record_probe(distance);
+    }
+
+    statistics.buckets += table.control.size();
+    statistics.bytes += table.control.capacity() * sizeof(std::uint8_t) + table.slots.capacity() * sizeof(Slot);
+}
+
+/**
+ * The table keeps at least one empty slot, so probing for a free slot always ends.
+ */
+std::size_t HashIndex::max_load(std::size_t capacity) const
+{
+    return std::min(capacity - 1, static_cast<std::size_t>(static_cast<double>(capacity) * this->_max_load_factor));
+}
+
+HashIndex::Table HashIndex::make_table(std::size_t capacity) const
+{
+    Table table;
+
+    table.control.assign(capacity, HashIndex::empty_control);
+    table.slots.resize(capacity);
+    table.growth_left = this->max_load(capacity);
+
+    return table;
+}
+
+void HashIndex::rehash(std::size_t capacity)
+{
+    this->migrate(std::numeric_limits<std::size_t>::max());
+
+    this->_old = std::move(this->_table);
+    this->_table = this->make_table(capacity);
+    this->_migrated = 0;
+
+    this->migrate(std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief Starts moving the rows into a table twice the size they need.
+ *
+ * The new table is sized from the live rows only, so a table full of tombstones is
+ * cleaned up rather than doubled. Half of its spare room is left for the inserts made
+ * while the old table drains, which bounds the number of groups moved per call.
+ */
+void HashIndex::grow()
+{
+    this->migrate(std::numeric_limits<std::size_t>::max());
+
+    std::size_t capacity = HashIndex::group_size;
+
+    while (this->max_load(capacity) < std::max<std::size_t>(1, 2 * this->_size))
+    {
+        capacity *= 2;
+    }
+
+    this->_old = std::move(this->_table);
+    this->_table = this->make_table(capacity);
+    this->_migrated = 0;
+
+    std::size_t old_groups = this->_old.control.size() / ControlGroup::width;
+    std::size_t spare = std::max<std::size_t>(1, this->max_load(capacity) - this->_size);
+
+    this->_migrate_stride = (2 * old_groups + spare - 1) / spare;
+
+    if (this->_migrate_stride == 0)
+    {
+        this->_migrate_stride = 1;
+    }
+}
+
+/**
+ * @brief Moves the rows of the next groups of the old table into the current one.
+ *
+ * Moved slots become tombstones, so rows erased afterwards cannot reappear through the
+ * old table. The old table is released once every group is moved.
+ */
+void HashIndex::migrate(std::size_t groups)
+{
+    if (!this->resizing())
+    {
+        return;
+    }
+
+    std::size_t old_groups = this->_old.control.size() / ControlGroup::width;
+    std::size_t end = old_groups - this->_migrated > groups ? this->_migrated + groups : old_groups;
+
+    for (std::size_t index = this->_migrated * ControlGroup::width; index < end * ControlGroup::width; ++index)
+    {
+        if ((this->_old.control[index] & HashIndex::empty_control) == 0)
+        {
+            HashIndex::emplace(this->_table, this->_old.slots[index].hash, this->_old.slots[index].row);
+            this->_old.control[index] = HashIndex::deleted_control;
+        }
+    }
+
+    this->_migrated = end;
+
+    if (this->_migrated == old_groups)
+    {
+        this->_old = Table();
+        this->_migrated = 0;
+    }
+}
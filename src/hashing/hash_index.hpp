@@ -0,0 +1,563 @@
+/**
+ * @file       <hash_index.hpp>
+ * @brief      This header file holds implementation of HashIndex class.
+ *
+ *             This calss implements flat open-addressing hash index over model rows.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef HASH_INDEX_HPP
+#define HASH_INDEX_HPP
+
+#ifndef MODEL_HPP
+#include "../model/model.hpp"
+#endif // MODEL_HPP
+
+#ifndef MODEL_TABLE_HPP
+#include "../model/model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#ifndef HASH_STATISTICS_HPP
+#include "hash_statistics.hpp"
+#endif // HASH_STATISTICS_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_INDEX_SSE2
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+/**
+ * @class HashIndex
+ * @brief Flat open-addressing (SwissTable-style) hash index of row indices.
+ *
+ * Every slot has a one-byte control value that is empty, deleted or holds 7 bits of the
+ * mixed hash. A lookup compares a whole group of control bytes at once (16 with SSE2,
+ * 8 inside a 64-bit word otherwise) and only touches the slots whose fingerprint
+ * matches. A slot stores the 32-bit hash and the 32-bit row index, the rows themselves
+ * stay in the dataset the index was built from.
+ *
+ * Groups are probed triangularly, which visits every group of a power-of-two table.
+ * Erased slots become tombstones, so the probe chains running through them stay intact.
+ *
+ * Growth does not stop the world. When the table reaches its maximum load factor a new
+ * table is allocated and every following insert or erase moves a few groups of the old
+ * one into it, while lookups check both. The stride is picked so the old table is
+ * drained long before the new one fills up.
+ */
+class HashIndex
+{
+public:
+    /**
+     * @brief Constructor for the HashIndex class.
+     */
+    HashIndex();
+
+    /**
+     * @brief Constructor for the HashIndex class.
+     *
+     * @param size The number of rows the index should hold without growing.
+     */
+    explicit HashIndex(std::size_t size);
+
+    /**
+     * @brief Destructor for the HashIndex class.
+     */
+    ~HashIndex();
+
+    /**
+     * @brief Copy constructor for the HashIndex class.
+     *
+     * @param other The other HashIndex to be copied.
+     */
+    HashIndex(const HashIndex& other) = default;
+
+    /**
+     * @brief Move constructor for the HashIndex class.
+     *
+     * Declared explicitly, the user-declared destructor would otherwise turn every move into a copy.
+     *
+     * @param other The other HashIndex to be moved from.
+     */
+    HashIndex(HashIndex&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the HashIndex class.
+     *
+     * @param other The other HashIndex to be copied.
+     *
+     * @return Reference to this HashIndex.
+     */
+    HashIndex& operator= (const HashIndex& other) = default;
+
+    /**
+     * @brief Move assignment operator for the HashIndex class.
+     *
+     * @param other The other HashIndex to be moved from.
+     *
+     * @return Reference to this HashIndex.
+     */
+    HashIndex& operator= (HashIndex&& other) noexcept = default;
+
+    /**
+     * @brief Makes room for the given number of rows.
+     *
+     * Unlike growth on insert, this rebuilds the table at once.
+     *
+     * @param size The number of rows the index should hold without growing.
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * @brief Adds a row to the index.
+     *
+     * Several rows may share the same hash.
+     *
+     * @param hash The hash of the row key.
+     * @param row The row index.
+     */
+    void insert(std::uint32_t hash, std::uint32_t row);
+
+    /**
+     * @brief Removes a row from the index.
+     *
+     * @param hash The hash the row was inserted with.
+     * @param row The row index.
+     *
+     * @return True if the row was found and removed.
+     */
+    bool erase(std::uint32_t hash, std::uint32_t row);
+
+    /**
+     * @brief Moves a row to a new hash after its key has changed.
+     *
+     * @param old_hash The hash the row was inserted with.
+     * @param new_hash The hash of the new key.
+     * @param row The row index.
+     *
+     * @return True if the row was found and updated.
+     */
+    bool update(std::uint32_t old_hash, std::uint32_t new_hash, std::uint32_t row);
+
+    /**
+     * @brief Finds a row inserted with the given hash.
+     *
+     * Same contract as Hashing::find_in_hash_table: only the hash is compared. When
+     * several rows share the hash, any one of them may be returned.
+     *
+     * @param hash The hash value.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    std::optional<std::uint32_t> find(std::uint32_t hash) const;
+
+    /**
+     * @brief Finds a row inserted with the given hash that satisfies a predicate.
+     *
+     * Callers holding the keys use the predicate to verify them, so rows whose hashes
+     * collide are skipped instead of being returned.
+     *
+     * @tparam Predicate Callable taking a row index and returning bool.
+     * @param hash The hash value.
+     * @param predicate The predicate, only called for rows with the same hash.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    template<typename Predicate>
+        std::optional<std::uint32_t> find(std::uint32_t hash, Predicate&& predicate) const;
+
+    /**
+     * @brief Finds rows for a batch of hashes.
+     *
+     * The home groups of a block of hashes are prefetched before any of them is probed,
+     * so the cache misses of the block overlap instead of being paid one after another.
+     * Every result follows the contract of find(hash).
+     *
+     * @param hashes The hash values.
+     * @param results Receives the result of every hash, at least as long as hashes.
+     *
+     * @throws std::invalid_argument If results is shorter than hashes.
+     */
+    void find_many(std::span<const std::uint32_t> hashes, std::span<std::optional<std::uint32_t>> results) const;
+
+    /**
+     * @brief Finds rows for a batch of hashes.
+     *
+     * @param hashes The hash values.
+     *
+     * @return The result of every hash, as find(hash) would return it.
+     */
+    std::vector<std::optional<std::uint32_t>> find_many(std::span<const std::uint32_t> hashes) const;
+
+    /**
+     * @brief Hints the processor to load the home group of a hash.
+     *
+     * Lets callers with their own batches, such as HashPostings, overlap lookups.
+     *
+     * @param hash The hash value.
+     */
+    void prefetch(std::uint32_t hash) const;
+
+    /**
+     * @brief Gets the number of rows in the index.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of slots of the current table.
+     *
+     * @return The number of slots.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Checks whether rows are still being moved out of the previous table.
+     *
+     * @return True while a resize is in progress.
+     */
+    bool resizing() const;
+
+    /**
+     * @brief Gets the maximum load factor.
+     *
+     * @return The share of slots, tombstones included, used before the table grows.
+     */
+    double max_load_factor() const;
+
+    /**
+     * @brief Sets the maximum load factor, applied from the next growth on.
+     *
+     * @param load_factor The share of slots that may be used, in [0.25, 0.9375].
+     *
+     * @throws std::invalid_argument If the load factor is out of range.
+     */
+    void max_load_factor(double load_factor);
+
+    /**
+     * @brief Gathers occupancy and probe statistics, counting both tables during a resize.
+     *
+     * @return The statistics.
+     */
+    HashStatistics statistics() const;
+
+    /**
+     * @brief Removes every row, the slots of the current table are kept.
+     */
+    void clear();
+
+    /**
+     * @brief Hashes the models and indexes them by their row in the vector.
+     *
+     * The models keep the computed hash, same as after Hashing::hash_model.
+     *
+     * @tparam Hasher Callable taking a std::string_view, see Hashing::dispatch.
+     * @param model_vector The model vector.
+     * @param hash_function The hash function.
+     *
+     * @return The index.
+     */
+    template<typename Hasher>
+        static HashIndex hash_model(std::vector<Model>& model_vector, Hasher&& hash_function);
+
+    /**
+     * @brief Hashes the rows of a model table and indexes them.
+     *
+     * The hash column of the table is filled by Hashing::hash_rows.
+     *
+     * @tparam Hasher Callable taking a std::string_view, see Hashing::dispatch.
+     * @param model_table The model table.
+     * @param hash_function The hash function.
+     * @param field The field to hash (0 - full name, 1 - department, 2 - job title).
+     *
+     * @return The index.
+     *
+     * @throws std::invalid_argument If the field is the employment date.
+     */
+    template<typename Hasher>
+        static HashIndex hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field = 0);
+
+private:
+    struct Slot
+    {
+        std::uint32_t   hash;   ///< Hash of the row key.
+        std::uint32_t   row;    ///< Row index in the indexed dataset.
+    };
+
+    struct Table
+    {
+        std::vector<std::uint8_t>   control;            ///< One control byte per slot.
+        std::vector<Slot>           slots;
+        std::size_t                 growth_left = 0;    ///< Empty slots that may still be filled.
+    };
+
+    class ControlGroup;
+
+    static constexpr std::uint8_t empty_control = 0x80;    ///< Full slots hold a 7-bit fingerprint, so the top bit marks free ones.
+    static constexpr std::uint8_t deleted_control = 0xFE;  ///< Tombstone, lookups probe past it.
+    static constexpr std::size_t group_size = 16;          ///< Capacity is always a multiple of the group size.
+    static constexpr std::size_t batch_size = 32;          ///< Lookups prefetched ahead by find_many.
+
+    /**
+     * @brief Spreads a 32-bit hash over 64 bits, so weak hashes still pick random groups.
+     *
+     * The top 7 bits of the result are the fingerprint and bits 32-56 pick the group.
+     */
+    static std::uint64_t mix_hash(std::uint32_t hash)
+    {
+        return static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    }
+
+    static std::uint8_t fingerprint(std::uint64_t mixed)
+    {
+        return static_cast<std::uint8_t>(mixed >> 57);
+    }
+
+    static void prefetch_address(const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    template<typename Predicate>
+        static std::optional<std::size_t> find_slot(const Table& table, std::uint32_t hash, Predicate&& predicate);
+
+    static void emplace(Table& table, std::uint32_t hash, std::uint32_t row);
+    static void table_statistics(const Table& table, HashStatistics& statistics);
+
+    std::size_t max_load(std::size_t capacity) const;
+    Table make_table(std::size_t capacity) const;
+
+    void rehash(std::size_t capacity);
+    void grow();
+    void migrate(std::size_t groups);
+
+    Table       _table;             ///< Table receiving every insert.
+    Table       _old;               ///< Table drained by a resize, empty otherwise.
+    std::size_t _migrated;          ///< Groups of the old table already moved.
+    std::size_t _migrate_stride;    ///< Groups moved by every insert or erase.
+    std::size_t _size;
+    double      _max_load_factor;
+};
+
+#ifdef HASH_INDEX_SSE2
+/**
+ * @class HashIndex::ControlGroup
+ * @brief Sixteen control bytes compared at once with SSE2.
+ *
+ * Masks hold one bit per slot.
+ */
+class HashIndex::ControlGroup
+{
+public:
+    static constexpr std::size_t width = 16;
+    static constexpr int shift = 0;
+
+    explicit ControlGroup(const std::uint8_t* control)
+    {
+        this->_control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    }
+
+    std::uint32_t match(std::uint8_t fingerprint) const
+    {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(fingerprint)), this->_control)));
+    }
+
+    std::uint32_t match_empty() const
+    {
+        return this->match(HashIndex::empty_control);
+    }
+
+    std::uint32_t match_free() const
+    {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(this->_control));
+    }
+
+private:
+    __m128i _control;
+};
+#else
+/**
+ * @class HashIndex::ControlGroup
+ * @brief Eight control bytes compared at once inside a 64-bit word.
+ *
+ * Masks hold the top bit of every matching byte. A fingerprint match may report a
+ * false positive right after a true one, lookups verify the stored hash anyway.
+ */
+class HashIndex::ControlGroup
+{
+public:
+    static constexpr std::size_t width = 8;
+    static constexpr int shift = 3;
+
+    static_assert(std::endian::native == std::endian::little, "portable control group expects little-endian words");
+
+    explicit ControlGroup(const std::uint8_t* control)
+    {
+        std::memcpy(&this->_control, control, sizeof(this->_control));
+    }
+
+    std::uint64_t match(std::uint8_t fingerprint) const
+    {
+        std::uint64_t word = this->_control ^ (lsbs * fingerprint);
+
+        return (word - lsbs) & ~word & msbs;
+    }
+
+    std::uint64_t match_empty() const
+    {
+        // Empty is 0b10000000 and deleted is 0b11111110, only empty has bit 1 clear.
+        return this->_control & ~(this->_control << 6) & msbs;
+    }
+
+    std::uint64_t match_free() const
+    {
+        return this->_control & msbs;
+    }
+
+private:
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+    static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+
+    std::uint64_t _control;
+};
+#endif
+
+inline void HashIndex::prefetch(std::uint32_t hash) const
+{
+    if (this->_table.control.empty())
+    {
+        return;
+    }
+
+    std::size_t group_mask = this->_table.control.size() / ControlGroup::width - 1;
+    std::size_t offset = (static_cast<std::size_t>(HashIndex::mix_hash(hash) >> 32) & group_mask) * ControlGroup::width;
+
+    HashIndex::prefetch_address(this->_table.control.data() + offset);
+    HashIndex::prefetch_address(this->_table.slots.data() + offset);
+    HashIndex::prefetch_address(this->_table.slots.data() + offset + ControlGroup::width - 1);
+}
+
+template<typename Predicate>
+std::optional<std::uint32_t> HashIndex::find(std::uint32_t hash, Predicate&& predicate) const
+{
+    std::optional<std::size_t> slot = HashIndex::find_slot(this->_table, hash, predicate);
+
+    if (slot.has_value())
+    {
+        return this->_table.slots[slot.value()].row;
+    }
+
+    if (this->_old.control.empty())
+    {
+        return std::nullopt;
+    }
+
+    slot = HashIndex::find_slot(this->_old, hash, predicate);
+
+    if (slot.has_value())
+    {
+        return this->_old.slots[slot.value()].row;
+    }
+
+    return std::nullopt;
+}
+
+template<typename Predicate>
+std::optional<std::size_t> HashIndex::find_slot(const Table& table, std::uint32_t hash, Predicate&& predicate)
+{
+    if (table.control.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::uint64_t mixed = HashIndex::mix_hash(hash);
+    std::uint8_t print = HashIndex::fingerprint(mixed);
+    std::size_t group_mask = table.control.size() / ControlGroup::width - 1;
+    std::size_t group = static_cast<std::size_t>(mixed >> 32) & group_mask;
+
+    for (std::size_t step = 1; step <= group_mask + 1; ++step)
+    {
+        std::size_t offset = group * ControlGroup::width;
+        ControlGroup control(table.control.data() + offset);
+
+        for (auto mask = control.match(print); mask != 0; mask &= mask - 1)
+        {
+            std::size_t index = offset + (std::countr_zero(mask) >> ControlGroup::shift);
+
+            if (table.slots[index].hash == hash && predicate(table.slots[index].row))
+            {
+                return index;
+            }
+        }
+
+        if (control.match_empty() != 0)
+        {
+            return std::nullopt;
+        }
+
+        group = (group + step) & group_mask;
+    }
+
+    return std::nullopt;
+}
+
+template<typename Hasher>
+HashIndex HashIndex::hash_model(std::vector<Model>& model_vector, Hasher&& hash_function)
+{
+    HashIndex index(model_vector.size());
+
+    for (std::size_t row = 0; row < model_vector.size(); ++row)
+    {
+        model_vector[row].set_hash_func(hash_function);
+        index.insert(model_vector[row].get_hash(), static_cast<std::uint32_t>(row));
+    }
+    return index;
+}
+
+template<typename Hasher>
+HashIndex HashIndex::hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field)
+{
+    Hashing::hash_rows(model_table, hash_function, field);
+
+    const std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    HashIndex index(hash_column.size());
+
+    for (std::size_t row = 0; row < hash_column.size(); ++row)
+    {
+        index.insert(hash_column[row], static_cast<std::uint32_t>(row));
+    }
+    return index;
+}
+
+#endif // HASH_INDEX_HPP
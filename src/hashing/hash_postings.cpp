@@ -0,0 +1,215 @@
+/**
+ * @file       <hash_postings.cpp>
+ * @brief      This source file holds implementation of HashPostings class.
+ *
+ *             This calss implements key-verified hash lookups returning every matching row.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "hash_postings.hpp"
+
+#include <algorithm>
+
+HashPostings::HashPostings()
+{
+    this->_key_offsets.push_back(0);
+    this->_row_offsets.push_back(0);
+    this->_hash_function = Hashing::Basic::id;
+}
+
+HashPostings::~HashPostings()
+{
+    return;
+}
+
+std::span<const std::uint32_t> HashPostings::find(const std::string& key) const
+{
+    if (this->_rows.empty())
+    {
+        return {};
+    }
+
+    std::uint32_t hash = Hashing::dispatch(this->_hash_function, [&](auto hash_function)
+    {
+        return static_cast<std::uint32_t>(hash_function(key));
+    });
+
+    std::optional<std::uint32_t> key_index = this->_index.find(hash, [&](std::uint32_t candidate)
+    {
+        return this->key(candidate) == key;
+    });
+
+    if (!key_index.has_value())
+    {
+        return {};
+    }
+
+    return this->postings(key_index.value());
+}
+
+/**
+ * Every block of keys goes through the dependent loads of a lookup one level at a time:
+ * index groups, then the key offsets and row offsets of the first candidate, then the
+ * candidate key bytes, and only then the comparison of the key with the candidate. The
+ * loads of one level are independent across keys, so their misses overlap. The index is
+ * probed once per key; only a key whose first candidate is another key with the same
+ * hash probes it again, verifying every candidate. The hash function is resolved once
+ * per block.
+ */
+std::vector<std::span<const std::uint32_t>> HashPostings::find_many(std::span<const std::string> keys) const
+{
+    std::vector<std::span<const std::uint32_t>> results(keys.size());
+
+    if (this->_rows.empty())
+    {
+        return results;
+    }
+
+    std::uint32_t hashes[HashPostings::batch_size];
+    std::optional<std::uint32_t> candidates[HashPostings::batch_size];
+
+    for (std::size_t begin = 0; begin < keys.size(); begin += HashPostings::batch_size)
+    {
+        std::size_t end = std::min(keys.size(), begin + HashPostings::batch_size);
+
+        Hashing::dispatch(this->_hash_function, [&](auto hash_function)
+        {
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                hashes[index - begin] = static_cast<std::uint32_t>(hash_function(keys[index]));
+                this->_index.prefetch(hashes[index - begin]);
+            }
+        });
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            candidates[index - begin] = this->_index.find(hashes[index - begin]);
+
+            if (candidates[index - begin].has_value())
+            {
+                HashPostings::prefetch_address(this->_key_offsets.data() + candidates[index - begin].value());
+                HashPostings::prefetch_address(this->_row_offsets.data() + candidates[index - begin].value());
+            }
+        }
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            if (candidates[index - begin].has_value())
+            {
+                HashPostings::prefetch_address(this->_key_data.data() + this->_key_offsets[candidates[index - begin].value()]);
+            }
+        }
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            if (!candidates[index - begin].has_value())
+            {
+                continue;
+            }
+
+            std::optional<std::uint32_t> key_index = candidates[index - begin];
+
+            if (this->key(key_index.value()) != keys[index])
+            {
+                key_index = this->_index.find(hashes[index - begin], [&](std::uint32_t candidate)
+                {
+                    return this->key(candidate) == keys[index];
+                });
+            }
+
+            if (key_index.has_value())
+            {
+                results[index] = this->postings(key_index.value());
+            }
+        }
+    }
+
+    return results;
+}
+
+std::size_t HashPostings::size() const
+{
+    return this->_rows.size();
+}
+
+std::size_t HashPostings::key_count() const
+{
+    return this->_key_offsets.size() - 1;
+}
+
+std::string_view HashPostings::key(std::size_t key_index) const
+{
+    return std::string_view(this->_key_data).substr(this->_key_offsets[key_index], this->_key_offsets[key_index + 1] - this->_key_offsets[key_index]);
+}
+
+std::span<const std::uint32_t> HashPostings::postings(std::size_t key_index) const
+{
+    return std::span<const std::uint32_t>(this->_rows).subspan(this->_row_offsets[key_index], this->_row_offsets[key_index + 1] - this->_row_offsets[key_index]);
+}
+
+/**
+ * @brief Groups the rows by key with a counting sort.
+ *
+ * The first pass assigns every row the number of its key, adding keys the first time
+ * they are seen. The second pass scatters the rows into their groups, which keeps them
+ * in ascending order inside every group.
+ */
+void HashPostings::build(std::span<const std::string_view> keys, std::span<const std::uint32_t> hashes)
+{
+    std::size_t size = keys.size();
+    std::vector<std::uint32_t> row_keys(size);
+    std::vector<std::uint32_t> key_sizes;
+
+    this->_index.reserve(size);
+
+    for (std::size_t row = 0; row < size; ++row)
+    {
+        std::string_view row_key = keys[row];
+        std::uint32_t hash = hashes[row];
+
+        std::optional<std::uint32_t> key_index = this->_index.find(hash, [&](std::uint32_t candidate)
+        {
+            return this->key(candidate) == row_key;
+        });
+
+        if (!key_index.has_value())
+        {
+            key_index = static_cast<std::uint32_t>(key_sizes.size());
+
+            this->_index.insert(hash, key_index.value());
+            this->_key_data.append(row_key);
+            this->_key_offsets.push_back(static_cast<std::uint32_t>(this->_key_data.size()));
+            key_sizes.push_back(0);
+        }
+
+        row_keys[row] = key_index.value();
+        ++key_sizes[key_index.value()];
+    }
+
+    this->_row_offsets.resize(key_sizes.size() + 1);
+
+    for (std::size_t key_index = 0; key_index < key_sizes.size(); ++key_index)
+    {
+        this->_row_offsets[key_index + 1] = this->_row_offsets[key_index] + key_sizes[key_index];
+    }
+
+    std::vector<std::uint32_t> next(this->_row_offsets.begin(), this->_row_offsets.end() - 1);
+
+    this->_rows.resize(size);
+
+    for (std::size_t row = 0; row < size; ++row)
+    {
+        this->_rows[next[row_keys[row]]++] = static_cast<std::uint32_t>(row);
+    }
+}
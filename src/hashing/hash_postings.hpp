@@ -0,0 +1,281 @@
+/**
+ * @file       <hash_postings.hpp>
+ * @brief      This header file holds implementation of HashPostings class.
+ *
+ *             This calss implements key-verified hash lookups returning every matching row.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef HASH_POSTINGS_HPP
+#define HASH_POSTINGS_HPP
+
+#ifndef HASH_INDEX_HPP
+#include "hash_index.hpp"
+#endif // HASH_INDEX_HPP
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class HashPostings
+ * @brief Hash index from distinct keys to the list of rows holding them.
+ *
+ * Every distinct key is stored once and gets a key number. The rows of a key are kept
+ * next to each other in one postings array, in ascending order, so a lookup hashes the
+ * key once, verifies it against the stored keys with the same hash and returns the
+ * matching rows as a single span. Colliding keys never produce wrong rows, and a key
+ * shared by many rows (a department, a job title) costs one probe plus its matches.
+ */
+class HashPostings
+{
+public:
+    /**
+     * @brief Constructor for the HashPostings class.
+     */
+    HashPostings();
+
+    /**
+     * @brief Destructor for the HashPostings class.
+     */
+    ~HashPostings();
+
+    /**
+     * @brief Copy constructor for the HashPostings class.
+     *
+     * @param other The other HashPostings to be copied.
+     */
+    HashPostings(const HashPostings& other) = default;
+
+    /**
+     * @brief Move constructor for the HashPostings class.
+     *
+     * @param other The other HashPostings to be moved from.
+     */
+    HashPostings(HashPostings&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the HashPostings class.
+     *
+     * @param other The other HashPostings to be copied.
+     *
+     * @return Reference to this HashPostings.
+     */
+    HashPostings& operator= (const HashPostings& other) = default;
+
+    /**
+     * @brief Move assignment operator for the HashPostings class.
+     *
+     * @param other The other HashPostings to be moved from.
+     *
+     * @return Reference to this HashPostings.
+     */
+    HashPostings& operator= (HashPostings&& other) noexcept = default;
+
+    /**
+     * @brief Finds every row holding the given key.
+     *
+     * @param key The key to search for.
+     *
+     * @return The matching rows in ascending order, empty if there are none.
+     */
+    std::span<const std::uint32_t> find(const std::string& key) const;
+
+    /**
+     * @brief Finds the rows of a batch of keys.
+     *
+     * Keys are resolved a block at a time, every level of dependent loads of the block is
+     * prefetched before the next one is read, which overlaps the cache misses of the lookups.
+     *
+     * @param keys The keys to search for.
+     *
+     * @return The matching rows of every key, as find(key) would return them.
+     */
+    std::vector<std::span<const std::uint32_t>> find_many(std::span<const std::string> keys) const;
+
+    /**
+     * @brief Gets the number of indexed rows.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of distinct keys.
+     *
+     * @return The number of keys.
+     */
+    std::size_t key_count() const;
+
+    /**
+     * @brief Gets a distinct key by its number.
+     *
+     * @param key_index The key number, less than key_count().
+     *
+     * @return The key.
+     */
+    std::string_view key(std::size_t key_index) const;
+
+    /**
+     * @brief Gets the rows holding a distinct key.
+     *
+     * @param key_index The key number, less than key_count().
+     *
+     * @return The rows in ascending order.
+     */
+    std::span<const std::uint32_t> postings(std::size_t key_index) const;
+
+    /**
+     * @brief Indexes the models of a vector by a string field.
+     *
+     * @tparam Hasher One of the Hashing function objects, see Hashing::dispatch.
+     * @param model_vector The model vector.
+     * @param hash_function The hash function, kept for the lookups.
+     * @param field The field to index (0 - full name, 1 - department, 2 - job title).
+     *
+     * @return The postings.
+     *
+     * @throws std::invalid_argument If the field is not a string field.
+     */
+    template<typename Hasher>
+        static HashPostings hash_model(const std::vector<Model>& model_vector, Hasher&& hash_function, std::uint8_t field = 0);
+
+    /**
+     * @brief Indexes the rows of a model table by a string field.
+     *
+     * @tparam Hasher One of the Hashing function objects, see Hashing::dispatch.
+     * @param model_table The model table.
+     * @param hash_function The hash function, kept for the lookups.
+     * @param field The field to index (0 - full name, 1 - department, 2 - job title).
+     *
+     * @return The postings.
+     *
+     * @throws std::invalid_argument If the field is not a string field.
+     */
+    template<typename Hasher>
+        static HashPostings hash_model(const ModelTable& model_table, Hasher&& hash_function, std::uint8_t field = 0);
+
+private:
+    static constexpr std::size_t batch_size = 32;  ///< Keys hashed and prefetched ahead by find_many.
+
+    static void prefetch_address(const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    /**
+     * @brief Hashes the key of every row in one loop compiled for the hash function and
+     * builds the postings from them.
+     */
+    template<typename Hasher>
+        static HashPostings hash_keys(const std::vector<std::string_view>& keys, Hasher&& hash_function);
+
+    void build(std::span<const std::string_view> keys, std::span<const std::uint32_t> hashes);
+
+    HashIndex                   _index;         ///< Key hash to key number.
+    std::string                 _key_data;      ///< Distinct keys stored back to back.
+    std::vector<std::uint32_t>  _key_offsets;   ///< Key `k` is _key_data[_key_offsets[k], _key_offsets[k + 1]).
+    std::vector<std::uint32_t>  _rows;          ///< Rows grouped by key.
+    std::vector<std::uint32_t>  _row_offsets;   ///< Rows of key `k` are _rows[_row_offsets[k], _row_offsets[k + 1]).
+    std::uint8_t                _hash_function; ///< Hashing::dispatch number of the function that hashes the keys.
+};
+
+template<typename Hasher>
+HashPostings HashPostings::hash_model(const std::vector<Model>& model_vector, Hasher&& hash_function, std::uint8_t field)
+{
+    if (field > 2)
+    {
+        throw std::invalid_argument("field should be a string field");
+    }
+
+    std::vector<std::string_view> keys(model_vector.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        if constexpr (!std::is_same_v<decltype(tag), Field::Date>)
+        {
+            for (std::size_t row = 0; row < model_vector.size(); ++row)
+            {
+                keys[row] = model_vector[row].template get_field<decltype(tag)>();
+            }
+        }
+    });
+
+    return HashPostings::hash_keys(keys, hash_function);
+}
+
+template<typename Hasher>
+HashPostings HashPostings::hash_model(const ModelTable& model_table, Hasher&& hash_function, std::uint8_t field)
+{
+    if (field > 2)
+    {
+        throw std::invalid_argument("field should be a string field");
+    }
+
+    std::vector<std::string_view> keys(model_table.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        using F = decltype(tag);
+
+        if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+        {
+            const std::pmr::vector<std::uint16_t>& key_column = model_table.code_column(F::index);
+            const ModelDictionary& dictionary = ModelDictionary::field_dictionary(F::index);
+
+            for (std::size_t row = 0; row < key_column.size(); ++row)
+            {
+                keys[row] = dictionary.decode(key_column[row]);
+            }
+        }
+        else if constexpr (std::is_same_v<F, Field::Name>)
+        {
+            const std::pmr::vector<std::pmr::string>& key_column = model_table.key_column<F>();
+
+            for (std::size_t row = 0; row < key_column.size(); ++row)
+            {
+                keys[row] = key_column[row];
+            }
+        }
+    });
+
+    return HashPostings::hash_keys(keys, hash_function);
+}
+
+template<typename Hasher>
+HashPostings HashPostings::hash_keys(const std::vector<std::string_view>& keys, Hasher&& hash_function)
+{
+    std::vector<std::uint32_t> hashes(keys.size());
+
+    for (std::size_t row = 0; row < keys.size(); ++row)
+    {
+        hashes[row] = static_cast<std::uint32_t>(hash_function(keys[row]));
+    }
+
+    HashPostings postings;
+    postings._hash_function = std::remove_cvref_t<Hasher>::id;
+    postings.build(keys, hashes);
+
+    return postings;
+}
+
+#endif // HASH_POSTINGS_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file       <hash_statistics.cpp>
+ * @brief      This source file holds implementation of HashStatistics class.
+ *
+ *             This calss implements occupancy and probe statistics of hash tables.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "hash_statistics.hpp"
+
+#include <algorithm>
+
+void HashStatistics::record_probe(std::size_t distance)
+{
+    if (distance >= this->probe_histogram.size())
+    {
+        this->probe_histogram.resize(distance + 1, 0);
+    }
+
+    ++this->probe_histogram[distance];
+    ++this->entries;
+    this->probe_total += distance;
+}
+
+void HashStatistics::merge(const HashStatistics& statistics)
+{
+    if (statistics.probe_histogram.size() > this->probe_histogram.size())
+    {
+        this->probe_histogram.resize(statistics.probe_histogram.size(), 0);
+    }
+
+    for (std::size_t distance = 0; distance < statistics.probe_histogram.size(); ++distance)
+    {
+        this->probe_histogram[distance] += statistics.probe_histogram[distance];
+    }
+
+    this->entries += statistics.entries;
+    this->buckets += statistics.buckets;
+    this->empty_buckets += statistics.empty_buckets;
+    this->deleted += statistics.deleted;
+    this->bytes += statistics.bytes;
+    this->probe_total += statistics.probe_total;
+}
+
+double HashStatistics::load_factor() const
+{
+    return (this->buckets == 0) ? 0.0 : static_cast<double>(this->entries) / this->buckets;
+}
+
+double HashStatistics::empty_ratio() const
+{
+    return (this->buckets == 0) ? 0.0 : static_cast<double>(this->empty_buckets) / this->buckets;
+}
+
+std::size_t HashStatistics::max_probe() const
+{
+    return this->probe_histogram.empty() ? 0 : this->probe_histogram.size() - 1;
+}
+
+double HashStatistics::average_probe() const
+{
+    return (this->entries == 0) ? 0.0 : static_cast<double>(this->probe_total) / this->entries;
+}
+
+double HashStatistics::bytes_per_entry() const
+{
+    return (this->entries == 0) ? 0.0 : static_cast<double>(this->bytes) / this->entries;
+}
+
+boost::json::object HashStatistics::to_json() const
+{
+    boost::json::object object;
+    boost::json::array histogram;
+
+    for (std::size_t count : this->probe_histogram)
+    {
+        histogram.push_back(count);
+    }
+
+    object.emplace("layout", this->layout);
+    object.emplace("entries", this->entries);
+    object.emplace("buckets", this->buckets);
+    object.emplace("load_factor", this->load_factor());
+    object.emplace("empty_ratio", this->empty_ratio());
+    object.emplace("deleted", this->deleted);
+    object.emplace("max_probe", this->max_probe());
+    object.emplace("average_probe", this->average_probe());
+    object.emplace("bytes_per_entry", this->bytes_per_entry());
+    object.emplace("probe_histogram", std::move(histogram));
+
+    return object;
+}
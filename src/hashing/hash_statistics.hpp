@@ -0,0 +1,146 @@
+/**
+ * @file       <hash_statistics.hpp>
+ * @brief      This header file holds implementation of HashStatistics class.
+ *
+ *             This calss implements occupancy and probe statistics of hash tables.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef HASH_STATISTICS_HPP
+#define HASH_STATISTICS_HPP
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/json.hpp>
+
+/**
+ * @class HashStatistics
+ * @brief Occupancy and probe statistics of a hash table.
+ *
+ * The probe distance of an entry is its position in its chain for chained tables, and
+ * the number of groups probed past its home group for flat ones, so a distance of 0
+ * means the entry is found on the first probe. Statistics are gathered by walking the
+ * table in place, nothing is copied.
+ */
+struct HashStatistics
+{
+    std::string                 layout;             ///< "chained", "flat", "partitioned" or "concurrent".
+    std::size_t                 entries = 0;
+    std::size_t                 buckets = 0;        ///< Chains of a chained table, slots of a flat one.
+    std::size_t                 empty_buckets = 0;
+    std::size_t                 deleted = 0;        ///< Tombstones of a flat table.
+    std::size_t                 bytes = 0;          ///< Estimated memory taken by the table, keys stored elsewhere excluded.
+    std::size_t                 probe_total = 0;    ///< Sum of the probe distances of all entries.
+    std::vector<std::size_t>    probe_histogram;    ///< Number of entries at every probe distance.
+
+    /**
+     * @brief Accounts an entry found at the given probe distance.
+     *
+     * @param distance The probe distance.
+     */
+    void record_probe(std::size_t distance);
+
+    /**
+     * @brief Adds the statistics of another table, such as another partition.
+     *
+     * @param statistics The statistics to add.
+     */
+    void merge(const HashStatistics& statistics);
+
+    /**
+     * @brief Gets the number of entries per bucket.
+     *
+     * @return The load factor.
+     */
+    double load_factor() const;
+
+    /**
+     * @brief Gets the share of empty buckets.
+     *
+     * @return The empty bucket ratio.
+     */
+    double empty_ratio() const;
+
+    /**
+     * @brief Gets the largest probe distance.
+     *
+     * @return The largest probe distance, 0 for an empty table.
+     */
+    std::size_t max_probe() const;
+
+    /**
+     * @brief Gets the mean probe distance of the entries.
+     *
+     * @return The average probe distance.
+     */
+    double average_probe() const;
+
+    /**
+     * @brief Gets the estimated memory per entry.
+     *
+     * @return The number of bytes per entry.
+     */
+    double bytes_per_entry() const;
+
+    /**
+     * @brief Converts the statistics into a JSON object.
+     *
+     * @return The JSON object.
+     */
+    boost::json::object to_json() const;
+
+    /**
+     * @brief Gathers the statistics of a chained hash table, as built by Hashing::hash_model.
+     *
+     * @tparam T The type of the chained values.
+     * @param hash_table The hash table.
+     *
+     * @return The statistics.
+     */
+    template<typename T>
+        static HashStatistics chained(const std::vector<std::list<T>>& hash_table);
+};
+
+/**
+ * Every list node holds the value and two links, the vector holds the list headers.
+ */
+template<typename T>
+HashStatistics HashStatistics::chained(const std::vector<std::list<T>>& hash_table)
+{
+    HashStatistics statistics;
+
+    statistics.layout = "chained";
+    statistics.buckets = hash_table.size();
+
+    for (const std::list<T>& chain : hash_table)
+    {
+        if (chain.empty())
+        {
+            ++statistics.empty_buckets;
+        }
+
+        for (std::size_t distance = 0; distance < chain.size(); ++distance)
+        {
+            statistics.record_probe(distance);
+        }
+    }
+
+    statistics.bytes = hash_table.capacity() * sizeof(std::list<T>) + statistics.entries * (sizeof(T) + 2 * sizeof(void*));
+
+    return statistics;
+}
+
+#endif // HASH_STATISTICS_HPP
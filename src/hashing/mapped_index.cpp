@@ -0,0 +1,413 @@
+/**
+ * @file       <mapped_index.cpp>
+ * @brief      This source file holds implementation of MappedHashIndex class.
+ *
+ *             This calss implements a hash index stored in a file and queried straight from its memory mapping.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "mapped_index.hpp"
+
+#ifndef MODEL_HPP
+#include "../model/model.hpp"
+#endif // MODEL_HPP
+
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_INDEX_MMAP
+#endif
+
+MappedHashIndex::FileView::FileView()
+{
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_mapped = false;
+}
+
+MappedHashIndex::FileView::FileView(const std::filesystem::path& path) : FileView()
+{
+#if defined(MAPPED_INDEX_MMAP)
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+
+    if (descriptor < 0)
+    {
+        throw std::runtime_error("cannot open " + path.string());
+    }
+
+    struct stat status;
+
+    if (::fstat(descriptor, &status) != 0)
+    {
+        ::close(descriptor);
+        throw std::runtime_error("cannot stat " + path.string());
+    }
+
+    this->_size = static_cast<std::size_t>(status.st_size);
+
+    if (this->_size != 0)
+    {
+        void* mapping = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("cannot map " + path.string());
+        }
+
+        this->_data = static_cast<const char*>(mapping);
+        this->_mapped = true;
+    }
+
+    ::close(descriptor);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file)
+    {
+        throw std::runtime_error("cannot open " + path.string());
+    }
+
+    this->_size = static_cast<std::size_t>(file.tellg());
+    this->_buffer = std::make_unique<std::uint64_t[]>((this->_size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+
+    file.seekg(0);
+
+    if (!file.read(reinterpret_cast<char*>(this->_buffer.get()), static_cast<std::streamsize>(this->_size)))
+    {
+        throw std::runtime_error("cannot read " + path.string());
+    }
+
+    this->_data = reinterpret_cast<const char*>(this->_buffer.get());
+#endif
+}
+
+MappedHashIndex::FileView::FileView(FileView&& other) noexcept : FileView()
+{
+    *this = std::move(other);
+}
+
+MappedHashIndex::FileView& MappedHashIndex::FileView::operator=(FileView&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->release();
+
+        this->_data = other._data;
+        this->_size = other._size;
+        this->_mapped = other._mapped;
+        this->_buffer = std::move(other._buffer);
+
+        other._data = nullptr;
+        other._size = 0;
+        other._mapped = false;
+    }
+    return *this;
+}
+
+MappedHashIndex::FileView::~FileView()
+{
+    this->release();
+    return;
+}
+
+const char* MappedHashIndex::FileView::data() const
+{
+    return this->_data;
+}
+
+std::size_t MappedHashIndex::FileView::size() const
+{
+    return this->_size;
+}
+
+void MappedHashIndex::FileView::release()
+{
+#if defined(MAPPED_INDEX_MMAP)
+    if (this->_mapped)
+    {
+        ::munmap(const_cast<char*>(this->_data), this->_size);
+    }
+#endif
+    this->_buffer.reset();
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_mapped = false;
+}
+
+MappedHashIndex::MappedHashIndex()
+{
+    this->_slots = nullptr;
+    this->_capacity = 0;
+    this->_size = 0;
+    this->_shift = 64;
+    this->_hash_function = 0;
+    this->_hash_field = 0;
+    this->_checksum = 0;
+}
+
+MappedHashIndex::MappedHashIndex(MappedHashIndex&& other) noexcept : MappedHashIndex()
+{
+    *this = std::move(other);
+}
+
+MappedHashIndex& MappedHashIndex::operator=(MappedHashIndex&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->_file = std::move(other._file);
+        this->_slots = other._slots;
+        this->_capacity = other._capacity;
+        this->_size = other._size;
+        this->_shift = other._shift;
+        this->_hash_function = other._hash_function;
+        this->_hash_field = other._hash_field;
+        this->_checksum = other._checksum;
+
+        other._slots = nullptr;
+        other._capacity = 0;
+        other._size = 0;
+    }
+    return *this;
+}
+
+MappedHashIndex::~MappedHashIndex()
+{
+    return;
+}
+
+std::optional<std::uint32_t> MappedHashIndex::find(std::uint32_t hash) const
+{
+    return this->find(hash, [](std::uint32_t)
+    {
+        return true;
+    });
+}
+
+std::size_t MappedHashIndex::size() const
+{
+    return this->_size;
+}
+
+std::size_t MappedHashIndex::capacity() const
+{
+    return this->_capacity;
+}
+
+std::size_t MappedHashIndex::bytes() const
+{
+    return this->_file.size();
+}
+
+std::uint8_t MappedHashIndex::hash_function() const
+{
+    return this->_hash_function;
+}
+
+std::uint8_t MappedHashIndex::hash_field() const
+{
+    return this->_hash_field;
+}
+
+bool MappedHashIndex::verify() const
+{
+    std::string_view slot_bytes(reinterpret_cast<const char*>(this->_slots), this->_capacity * sizeof(std::uint64_t));
+
+    return Hashing::crc32c_hashing_function(slot_bytes) == this->_checksum;
+}
+
+/**
+ * Without the checksum every check reads the header and stats the dataset, so a stale
+ * index is caught by its dataset stamp and a damaged one only when checked is set.
+ */
+MappedHashIndex MappedHashIndex::open(const std::filesystem::path& index_path, const std::filesystem::path& dataset_path, std::uint8_t hash_field, bool checked)
+{
+    static_assert(sizeof(FileHeader) == 64 && std::is_trivially_copyable_v<FileHeader>, "the header is 64 raw bytes");
+
+    MappedHashIndex index;
+    index._file = FileView(index_path);
+
+    FileHeader header;
+
+    if (index._file.size() < sizeof(FileHeader))
+    {
+        throw std::runtime_error(index_path.string() + " is not a hash index");
+    }
+
+    std::memcpy(&header, index._file.data(), sizeof(FileHeader));
+
+    if (std::memcmp(header.magic, MappedHashIndex::magic, sizeof(header.magic)) != 0)
+    {
+        throw std::runtime_error(index_path.string() + " is not a hash index");
+    }
+
+    if (header.byte_order != MappedHashIndex::byte_order_mark)
+    {
+        throw std::runtime_error(index_path.string() + " was written on a machine with another byte order");
+    }
+
+    if (header.version != MappedHashIndex::version)
+    {
+        throw std::runtime_error(index_path.string() + " has format version " + std::to_string(header.version) + ", expected " + std::to_string(MappedHashIndex::version));
+    }
+
+    if (header.capacity < MappedHashIndex::min_capacity || !std::has_single_bit(header.capacity) || header.entries > header.capacity / 2 ||
+        index._file.size() != sizeof(FileHeader) + header.capacity * sizeof(std::uint64_t))
+    {
+        throw std::runtime_error(index_path.string() + " is truncated or damaged");
+    }
+
+    if (header.hash_field != hash_field)
+    {
+        throw std::runtime_error(index_path.string() + " is hashed on field " + std::to_string(static_cast<unsigned int>(header.hash_field)) + ", expected " + std::to_string(static_cast<unsigned int>(hash_field)));
+    }
+
+    DatasetStamp stamp = MappedHashIndex::dataset_stamp(dataset_path);
+
+    if (stamp.size != header.dataset_size || stamp.mtime != header.dataset_mtime || stamp.inode != header.dataset_inode)
+    {
+        throw std::runtime_error(index_path.string() + " was built from another version of " + dataset_path.string());
+    }
+
+    index._slots = reinterpret_cast<const std::uint64_t*>(index._file.data() + sizeof(FileHeader));
+    index._capacity = static_cast<std::size_t>(header.capacity);
+    index._size = static_cast<std::size_t>(header.entries);
+    index._shift = 64 - static_cast<unsigned int>(std::countr_zero(header.capacity));
+    index._hash_function = header.hash_function;
+    index._hash_field = header.hash_field;
+    index._checksum = header.checksum;
+
+    if (checked && !index.verify())
+    {
+        throw std::runtime_error(index_path.string() + " does not match its checksum");
+    }
+
+    return index;
+}
+
+void MappedHashIndex::save(const std::filesystem::path& index_path, const std::filesystem::path& dataset_path, std::span<const std::uint32_t> hashes, std::uint8_t hash_function, std::uint8_t hash_field)
+{
+    if (hashes.size() >= std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::invalid_argument("an index holds less than UINT32_MAX rows");
+    }
+
+    std::size_t capacity = MappedHashIndex::min_capacity;
+
+    while (capacity / 2 < hashes.size())
+    {
+        capacity *= 2;
+    }
+
+    unsigned int shift = 64 - static_cast<unsigned int>(std::countr_zero(capacity));
+    std::vector<std::uint64_t> slots(capacity, MappedHashIndex::empty_slot);
+
+    for (std::size_t row = 0; row < hashes.size(); ++row)
+    {
+        std::size_t index = MappedHashIndex::home(hashes[row], shift);
+
+        while (slots[index] != MappedHashIndex::empty_slot)
+        {
+            index = (index + 1) & (capacity - 1);
+        }
+
+        slots[index] = (static_cast<std::uint64_t>(row) << 32) | hashes[row];
+    }
+
+    DatasetStamp stamp = MappedHashIndex::dataset_stamp(dataset_path);
+
+    FileHeader header{};
+
+    std::memcpy(header.magic, MappedHashIndex::magic, sizeof(header.magic));
+    header.version = MappedHashIndex::version;
+    header.byte_order = MappedHashIndex::byte_order_mark;
+    header.capacity = capacity;
+    header.entries = hashes.size();
+    header.dataset_size = stamp.size;
+    header.dataset_mtime = stamp.mtime;
+    header.dataset_inode = stamp.inode;
+    header.checksum = Hashing::crc32c_hashing_function(std::string_view(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(std::uint64_t)));
+    header.hash_function = hash_function;
+    header.hash_field = hash_field;
+
+    std::filesystem::path temporary_path = index_path;
+    temporary_path += ".tmp";
+
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        file.write(reinterpret_cast<const char*>(slots.data()), static_cast<std::streamsize>(slots.size() * sizeof(std::uint64_t)));
+
+        if (!file.flush())
+        {
+            throw std::runtime_error("cannot write " + temporary_path.string());
+        }
+    }
+
+    std::filesystem::rename(temporary_path, index_path);
+}
+
+std::filesystem::path MappedHashIndex::index_path(const std::filesystem::path& dataset_path)
+{
+    std::filesystem::path index_path = dataset_path;
+    index_path += ".hidx";
+
+    return index_path;
+}
+
+MappedHashIndex::DatasetStamp MappedHashIndex::dataset_stamp(const std::filesystem::path& dataset_path)
+{
+#if defined(MAPPED_INDEX_MMAP)
+    struct stat status;
+
+    if (::stat(dataset_path.c_str(), &status) != 0)
+    {
+        throw std::runtime_error("cannot stat " + dataset_path.string());
+    }
+
+#if defined(__APPLE__)
+    std::int64_t mtime = static_cast<std::int64_t>(status.st_mtimespec.tv_sec) * 1000000000 + status.st_mtimespec.tv_nsec;
+#else
+    std::int64_t mtime = static_cast<std::int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+#endif
+
+    return {static_cast<std::uint64_t>(status.st_size), mtime, static_cast<std::uint64_t>(status.st_ino)};
+#else
+    std::error_code error;
+    std::uintmax_t size = std::filesystem::file_size(dataset_path, error);
+    std::filesystem::file_time_type mtime = std::filesystem::last_write_time(dataset_path, error);
+
+    if (error)
+    {
+        throw std::runtime_error("cannot stat " + dataset_path.string());
+    }
+
+    return {static_cast<std::uint64_t>(size), static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count()), 0};
+#endif
+}
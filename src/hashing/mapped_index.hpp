@@ -0,0 +1,288 @@
+/**
+ * @file       <mapped_index.hpp>
+ * @brief      This header file holds implementation of MappedHashIndex class.
+ *
+ *             This calss implements a hash index stored in a file and queried straight from its memory mapping.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MAPPED_INDEX_HPP
+#define MAPPED_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+
+/**
+ * @class MappedHashIndex
+ * @brief Read-only hash index of row indices persisted in a position-independent file.
+ *
+ * The file is a 64-byte header followed by a power-of-two array of 64-bit slots, each
+ * holding the 32-bit hash and the 32-bit row of an entry, probed linearly. Nothing in
+ * it is a pointer, so opening maps the file and checks its header, and the first lookup
+ * reads the slots where they lie; there is no rebuild and no per-entry work.
+ *
+ * The header carries a format version, a byte-order mark, the hash function the rows
+ * were hashed with (a Hashing::dispatch number), the field they were hashed on, a CRC32C
+ * of the slots and the size, modification time and inode of the dataset file the index
+ * was built from. Opening compares only the header with a stat of the dataset, so it
+ * costs the same for any size of either file; the checksum is compared on request.
+ * A file that belongs to another version of the dataset, another hash field or another
+ * format is refused instead of answering wrong rows.
+ *
+ * Files are mapped with mmap on POSIX systems and read into memory elsewhere.
+ */
+class MappedHashIndex
+{
+public:
+    static constexpr std::uint32_t version = 2;     ///< Format version written into new files.
+
+    /**
+     * @brief Constructor for the MappedHashIndex class, the index is empty.
+     */
+    MappedHashIndex();
+
+    MappedHashIndex(MappedHashIndex&& other) noexcept;
+    MappedHashIndex& operator=(MappedHashIndex&& other) noexcept;
+
+    MappedHashIndex(const MappedHashIndex&) = delete;
+    MappedHashIndex& operator=(const MappedHashIndex&) = delete;
+
+    /**
+     * @brief Destructor for the MappedHashIndex class, unmaps the file.
+     */
+    ~MappedHashIndex();
+
+    /**
+     * @brief Finds a row stored with the given hash.
+     *
+     * Same contract as HashIndex::find: only the hash is compared.
+     *
+     * @param hash The hash value.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    std::optional<std::uint32_t> find(std::uint32_t hash) const;
+
+    /**
+     * @brief Finds a row with the given hash that satisfies a predicate.
+     *
+     * @tparam Predicate Callable taking a row index and returning bool.
+     * @param hash The hash value.
+     * @param predicate The predicate, only called for rows with the same hash.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    template<typename Predicate>
+        std::optional<std::uint32_t> find(std::uint32_t hash, Predicate&& predicate) const;
+
+    /**
+     * @brief Gets the number of rows in the index.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of slots.
+     *
+     * @return The number of slots.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Gets the size of the index file.
+     *
+     * @return The number of bytes.
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Gets the hash function the rows were hashed with.
+     *
+     * @return The Hashing::dispatch number of the function.
+     */
+    std::uint8_t hash_function() const;
+
+    /**
+     * @brief Gets the field the rows were hashed on.
+     *
+     * @return The Field number.
+     */
+    std::uint8_t hash_field() const;
+
+    /**
+     * @brief Compares the slots with the checksum written with them.
+     *
+     * Reads the whole index once, open leaves it out unless asked for it.
+     *
+     * @return True if the slots match their checksum.
+     */
+    bool verify() const;
+
+    /**
+     * @brief Opens an index file and checks it against the dataset it should index.
+     *
+     * @param index_path The index file.
+     * @param dataset_path The dataset file.
+     * @param hash_field The Field number the rows are expected to be hashed on.
+     * @param checked Whether the slots are also compared with their checksum.
+     *
+     * @return The index.
+     *
+     * @throws std::runtime_error If either file cannot be read, the index file is not a
+     * valid index of this version, it was built from a different dataset or hashed on
+     * another field, or, when checked, its checksum does not match.
+     */
+    static MappedHashIndex open(const std::filesystem::path& index_path, const std::filesystem::path& dataset_path, std::uint8_t hash_field, bool checked = false);
+
+    /**
+     * @brief Writes an index of the given hashes, row `r` having hashes[r].
+     *
+     * The file is written next to its final name and renamed over it, so a reader never
+     * maps a half-written index.
+     *
+     * @param index_path The index file.
+     * @param dataset_path The dataset file the hashes come from.
+     * @param hashes The hash of every row.
+     * @param hash_function The Hashing::dispatch number of the function that produced the hashes.
+     * @param hash_field The Field number the hashes were computed on.
+     *
+     * @throws std::invalid_argument If there are UINT32_MAX rows or more.
+     * @throws std::runtime_error If either file cannot be read or written.
+     */
+    static void save(const std::filesystem::path& index_path, const std::filesystem::path& dataset_path, std::span<const std::uint32_t> hashes, std::uint8_t hash_function, std::uint8_t hash_field);
+
+    /**
+     * @brief Gets the index file kept next to a dataset file.
+     *
+     * @param dataset_path The dataset file.
+     *
+     * @return The dataset file name with ".hidx" appended.
+     */
+    static std::filesystem::path index_path(const std::filesystem::path& dataset_path);
+
+private:
+    struct FileHeader
+    {
+        char            magic[8];
+        std::uint32_t   version;
+        std::uint32_t   byte_order;         ///< byte_order_mark as written by the producing machine.
+        std::uint64_t   capacity;
+        std::uint64_t   entries;
+        std::uint64_t   dataset_size;
+        std::int64_t    dataset_mtime;      ///< Modification time of the dataset in nanoseconds.
+        std::uint64_t   dataset_inode;      ///< Inode of the dataset, 0 where there are none.
+        std::uint32_t   checksum;           ///< CRC32C of the slots.
+        std::uint8_t    hash_function;
+        std::uint8_t    hash_field;
+        std::uint8_t    reserved[2];
+    };
+
+    struct DatasetStamp
+    {
+        std::uint64_t   size;
+        std::int64_t    mtime;
+        std::uint64_t   inode;
+    };
+
+    /**
+     * @brief A read-only view of a whole file, mapped or, without mmap, copied into memory.
+     */
+    class FileView
+    {
+    public:
+        FileView();
+        explicit FileView(const std::filesystem::path& path);
+        FileView(FileView&& other) noexcept;
+        FileView& operator=(FileView&& other) noexcept;
+        ~FileView();
+
+        FileView(const FileView&) = delete;
+        FileView& operator=(const FileView&) = delete;
+
+        const char* data() const;
+        std::size_t size() const;
+
+    private:
+        void release();
+
+        const char*                         _data;
+        std::size_t                         _size;
+        bool                                _mapped;
+        std::unique_ptr<std::uint64_t[]>    _buffer;    ///< Holds the file where it is not mapped, 8-byte aligned like a mapping.
+    };
+
+    static constexpr char magic[8] = {'M', 'O', 'D', 'E', 'L', 'I', 'D', 'X'};
+    static constexpr std::uint32_t byte_order_mark = 0x01020304;
+    static constexpr std::uint64_t empty_slot = ~std::uint64_t{0};
+    static constexpr std::size_t min_capacity = 16;
+
+    static std::size_t home(std::uint32_t hash, unsigned int shift)
+    {
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    /**
+     * @brief Gets the size, modification time and inode of a dataset file, without reading it.
+     */
+    static DatasetStamp dataset_stamp(const std::filesystem::path& dataset_path);
+
+    FileView                _file;
+    const std::uint64_t*    _slots;
+    std::size_t             _capacity;
+    std::size_t             _size;
+    unsigned int            _shift;
+    std::uint8_t            _hash_function;
+    std::uint8_t            _hash_field;
+    std::uint32_t           _checksum;
+};
+
+template<typename Predicate>
+std::optional<std::uint32_t> MappedHashIndex::find(std::uint32_t hash, Predicate&& predicate) const
+{
+    if (this->_capacity == 0)
+    {
+        return std::nullopt;
+    }
+
+    std::size_t mask = this->_capacity - 1;
+
+    std::size_t index = MappedHashIndex::home(hash, this->_shift);
+
+    // A well-formed table always has an empty slot, a damaged file may not, so the probe
+    // stops after visiting every slot once.
+    for (std::size_t step = 0; step < this->_capacity; ++step, index = (index + 1) & mask)
+    {
+        std::uint64_t entry = this->_slots[index];
+
+        if (entry == MappedHashIndex::empty_slot)
+        {
+            return std::nullopt;
+        }
+
+        if (static_cast<std::uint32_t>(entry) == hash && predicate(static_cast<std::uint32_t>(entry >> 32)))
+        {
+            return static_cast<std::uint32_t>(entry >> 32);
+        }
+    }
+
+    return std::nullopt;
+}
+
+#endif // MAPPED_INDEX_HPP
@@ -0,0 +1,232 @@
+/**
+ * @file       <partitioned_index.cpp>
+ * @brief      This source file holds implementation of PartitionedHashIndex class.
+ *
+ *             This calss implements radix-partitioned hash index built by several threads..
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "partitioned_index.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+PartitionedHashIndex::PartitionedHashIndex()
+{
+    this->_partition_bits = 0;
+    this->_size = 0;
+}
+
+PartitionedHashIndex::~PartitionedHashIndex()
+{
+    return;
+}
+
+std::optional<std::uint32_t> PartitionedHashIndex::find(std::uint32_t hash) const
+{
+    return this->find(hash, [](std::uint32_t)
+    {
+        return true;
+    });
+}
+
+std::size_t PartitionedHashIndex::size() const
+{
+    return this->_size;
+}
+
+std::size_t PartitionedHashIndex::capacity() const
+{
+    std::size_t capacity = 0;
+
+    for (const HashIndex& partition : this->_partitions)
+    {
+        capacity += partition.capacity();
+    }
+    return capacity;
+}
+
+std::size_t PartitionedHashIndex::partition_count() const
+{
+    return this->_partitions.size();
+}
+
+HashStatistics PartitionedHashIndex::statistics() const
+{
+    HashStatistics statistics;
+
+    statistics.layout = "partitioned";
+
+    for (const HashIndex& partition : this->_partitions)
+    {
+        statistics.merge(partition.statistics());
+    }
+    return statistics;
+}
+
+std::size_t PartitionedHashIndex::thread_count(std::size_t threads)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(1, threads);
+}
+
+template<typename Task>
+void PartitionedHashIndex::run_parallel(std::size_t threads, Task&& task)
+{
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+
+    workers.reserve(threads - 1);
+
+    auto guarded = [&](std::size_t thread)
+    {
+        try
+        {
+            task(thread);
+        }
+        catch (...)
+        {
+            errors[thread] = std::current_exception();
+        }
+    };
+
+    for (std::size_t thread = 1; thread < threads; ++thread)
+    {
+        workers.emplace_back(guarded, thread);
+    }
+
+    guarded(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * Every thread works on the rows [size * t / threads, size * (t + 1) / threads) in the
+ * first two passes and on the partitions t, t + threads, ... in the last one. There are
+ * at least four partitions per thread, which evens out partitions of unequal size, and
+ * large inputs get more so that every partition being filled stays cache-sized.
+ */
+PartitionedHashIndex PartitionedHashIndex::build_rows(std::size_t size, std::size_t threads, const HashRows& hash_rows)
+{
+    struct Entry
+    {
+        std::uint32_t   hash;
+        std::uint32_t   row;
+    };
+
+    PartitionedHashIndex index;
+
+    threads = std::min(PartitionedHashIndex::thread_count(threads), std::max<std::size_t>(1, size));
+
+    while (index._partition_bits < PartitionedHashIndex::max_partition_bits &&
+           ((std::size_t{1} << index._partition_bits) < threads * 4 || (size >> index._partition_bits) > PartitionedHashIndex::partition_rows))
+    {
+        ++index._partition_bits;
+    }
+
+    std::size_t partitions = std::size_t{1} << index._partition_bits;
+
+    std::vector<std::uint32_t> hashes(size);
+    std::vector<std::size_t> counts(threads * partitions, 0);
+    std::vector<Entry> entries(size);
+
+    index._partitions.resize(partitions);
+    index._size = size;
+
+    auto row_begin = [&](std::size_t thread)
+    {
+        return size * thread / threads;
+    };
+
+    PartitionedHashIndex::run_parallel(threads, [&](std::size_t thread)
+    {
+        std::size_t* thread_counts = counts.data() + thread * partitions;
+
+        hash_rows(row_begin(thread), row_begin(thread + 1), hashes.data());
+
+        for (std::size_t row = row_begin(thread); row < row_begin(thread + 1); ++row)
+        {
+            ++thread_counts[index.partition_of(hashes[row])];
+        }
+    });
+
+    // Turns the counts into write offsets: partitions one after another, and the rows
+    // of every partition in thread order.
+    std::vector<std::size_t> partition_offsets(partitions + 1, 0);
+    std::size_t offset = 0;
+
+    for (std::size_t partition = 0; partition < partitions; ++partition)
+    {
+        partition_offsets[partition] = offset;
+
+        for (std::size_t thread = 0; thread < threads; ++thread)
+        {
+            std::size_t count = counts[thread * partitions + partition];
+
+            counts[thread * partitions + partition] = offset;
+            offset += count;
+        }
+    }
+    partition_offsets[partitions] = offset;
+
+    PartitionedHashIndex::run_parallel(threads, [&](std::size_t thread)
+    {
+        std::size_t* thread_offsets = counts.data() + thread * partitions;
+
+        for (std::size_t row = row_begin(thread); row < row_begin(thread + 1); ++row)
+        {
+            entries[thread_offsets[index.partition_of(hashes[row])]++] = Entry{hashes[row], static_cast<std::uint32_t>(row)};
+        }
+    });
+
+    PartitionedHashIndex::run_parallel(threads, [&](std::size_t thread)
+    {
+        for (std::size_t partition = thread; partition < partitions; partition += threads)
+        {
+            HashIndex& partition_index = index._partitions[partition];
+
+            partition_index.reserve(partition_offsets[partition + 1] - partition_offsets[partition]);
+
+            for (std::size_t entry = partition_offsets[partition]; entry < partition_offsets[partition + 1]; ++entry)
+            {
+                partition_index.insert(entries[entry].hash, entries[entry].row);
+            }
+        }
+    });
+
+    return index;
+}
+
+PartitionedHashIndex PartitionedHashIndex::build(std::span<const std::uint32_t> hashes, std::size_t threads)
+{
+    return PartitionedHashIndex::build_rows(hashes.size(), threads, [&](std::size_t begin, std::size_t end, std::uint32_t* output)
+    {
+        std::copy(hashes.begin() + begin, hashes.begin() + end, output + begin);
+    });
+}
@@ -0,0 +1,304 @@
+/**
+ * @file       <partitioned_index.hpp>
+ * @brief      This header file holds implementation of PartitionedHashIndex class.
+ *
+ *             This calss implements radix-partitioned hash index built by several threads..
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef PARTITIONED_INDEX_HPP
+#define PARTITIONED_INDEX_HPP
+
+#ifndef HASH_INDEX_HPP
+#include "hash_index.hpp"
+#endif // HASH_INDEX_HPP
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @class PartitionedHashIndex
+ * @brief Hash index split into independent HashIndex partitions, built in parallel.
+ *
+ * The top bits of the scrambled row hash pick the partition, so a lookup probes exactly
+ * one partition. The build runs in three passes over fixed row ranges, one per thread:
+ * every thread hashes its rows and counts them per partition, then scatters them into
+ * a buffer grouped by partition at offsets taken from the prefix sums of the counts,
+ * and finally every thread fills the partitions it owns. No pass shares a write
+ * location between threads, so there are no locks.
+ */
+class PartitionedHashIndex
+{
+public:
+    /**
+     * @brief Constructor for the PartitionedHashIndex class.
+     */
+    PartitionedHashIndex();
+
+    /**
+     * @brief Destructor for the PartitionedHashIndex class.
+     */
+    ~PartitionedHashIndex();
+
+    /**
+     * @brief Copy constructor for the PartitionedHashIndex class.
+     *
+     * @param other The other PartitionedHashIndex to be copied.
+     */
+    PartitionedHashIndex(const PartitionedHashIndex& other) = default;
+
+    /**
+     * @brief Move constructor for the PartitionedHashIndex class.
+     *
+     * @param other The other PartitionedHashIndex to be moved from.
+     */
+    PartitionedHashIndex(PartitionedHashIndex&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the PartitionedHashIndex class.
+     *
+     * @param other The other PartitionedHashIndex to be copied.
+     *
+     * @return Reference to this PartitionedHashIndex.
+     */
+    PartitionedHashIndex& operator= (const PartitionedHashIndex& other) = default;
+
+    /**
+     * @brief Move assignment operator for the PartitionedHashIndex class.
+     *
+     * @param other The other PartitionedHashIndex to be moved from.
+     *
+     * @return Reference to this PartitionedHashIndex.
+     */
+    PartitionedHashIndex& operator= (PartitionedHashIndex&& other) noexcept = default;
+
+    /**
+     * @brief Finds a row with the given hash, same contract as HashIndex::find.
+     *
+     * @param hash The hash value.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    std::optional<std::uint32_t> find(std::uint32_t hash) const;
+
+    /**
+     * @brief Finds a row with the given hash that satisfies a predicate.
+     *
+     * @tparam Predicate Callable taking a row index and returning bool.
+     * @param hash The hash value.
+     * @param predicate The predicate, only called for rows with the same hash.
+     *
+     * @return The row index if found, otherwise an empty optional.
+     */
+    template<typename Predicate>
+        std::optional<std::uint32_t> find(std::uint32_t hash, Predicate&& predicate) const
+    {
+        if (this->_partitions.empty())
+        {
+            return std::nullopt;
+        }
+
+        return this->_partitions[this->partition_of(hash)].find(hash, std::forward<Predicate>(predicate));
+    }
+
+    /**
+     * @brief Gets the number of rows in the index.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of slots over all partitions.
+     *
+     * @return The number of slots.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Gets the number of partitions.
+     *
+     * @return The number of partitions.
+     */
+    std::size_t partition_count() const;
+
+    /**
+     * @brief Gathers the statistics of every partition.
+     *
+     * @return The statistics of the partitions added together.
+     */
+    HashStatistics statistics() const;
+
+    /**
+     * @brief Resolves a requested thread count.
+     *
+     * @param threads The requested number of threads, 0 for every hardware thread.
+     *
+     * @return The number of threads a build will use, at least 1.
+     */
+    static std::size_t thread_count(std::size_t threads);
+
+    /**
+     * @brief Indexes precomputed hashes by their position.
+     *
+     * @param hashes The hash of every row.
+     * @param threads The number of threads, 0 for every hardware thread.
+     *
+     * @return The index.
+     */
+    static PartitionedHashIndex build(std::span<const std::uint32_t> hashes, std::size_t threads = 0);
+
+    /**
+     * @brief Hashes the models in parallel and indexes them by their row in the vector.
+     *
+     * The models keep the computed hash, same as after HashIndex::hash_model.
+     *
+     * @tparam Hasher Callable taking a std::string_view, see Hashing::dispatch.
+     * @param model_vector The model vector.
+     * @param hash_function The hash function, called from several threads at once.
+     * @param threads The number of threads, 0 for every hardware thread.
+     *
+     * @return The index.
+     */
+    template<typename Hasher>
+        static PartitionedHashIndex hash_model(std::vector<Model>& model_vector, Hasher&& hash_function, std::size_t threads = 0);
+
+    /**
+     * @brief Hashes the rows of a model table in parallel and indexes them.
+     *
+     * Fills the hash column of the table, same as Hashing::hash_rows.
+     *
+     * @tparam Hasher Callable taking a std::string_view, see Hashing::dispatch.
+     * @param model_table The model table.
+     * @param hash_function The hash function, called from several threads at once.
+     * @param field The field to hash (0 - full name, 1 - department, 2 - job title).
+     * @param threads The number of threads, 0 for every hardware thread.
+     *
+     * @return The index.
+     *
+     * @throws std::invalid_argument If the field is the employment date.
+     */
+    template<typename Hasher>
+        static PartitionedHashIndex hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field = 0, std::size_t threads = 0);
+
+private:
+    /**
+     * @brief Picks the partition from the top bits of the hash scrambled by a 32-bit
+     * Fibonacci multiplier, so small hash values still spread over every partition.
+     */
+    std::size_t partition_of(std::uint32_t hash) const
+    {
+        return (this->_partition_bits == 0) ? 0 : ((hash * 0x9E3779B1u) >> (32 - this->_partition_bits));
+    }
+
+    /**
+     * @brief Runs the task on the given number of threads, the calling one included.
+     *
+     * The task gets the thread number. The first exception thrown by any thread is
+     * rethrown once every thread has finished.
+     */
+    template<typename Task>
+        static void run_parallel(std::size_t threads, Task&& task);
+
+    /**
+     * @brief Hashes the rows [begin, end) into output[begin, end).
+     *
+     * Called once per thread, the loop over the rows is inside, so the hash function
+     * is compiled into it and only this call goes through the std::function.
+     */
+    using HashRows = std::function<void(std::size_t begin, std::size_t end, std::uint32_t* output)>;
+
+    /**
+     * @brief Partitions the hashes and fills the partitions, the hashes are read through
+     * the callable after the given thread has produced them.
+     */
+    static PartitionedHashIndex build_rows(std::size_t size, std::size_t threads, const HashRows& hash_rows);
+
+    static constexpr unsigned int max_partition_bits = 12;
+    static constexpr std::size_t partition_rows = std::size_t{1} << 18;    ///< Rows per partition past which the input is split further.
+
+    std::vector<HashIndex>  _partitions;
+    unsigned int            _partition_bits;
+    std::size_t             _size;
+};
+
+template<typename Hasher>
+PartitionedHashIndex PartitionedHashIndex::hash_model(std::vector<Model>& model_vector, Hasher&& hash_function, std::size_t threads)
+{
+    return PartitionedHashIndex::build_rows(model_vector.size(), threads, [&](std::size_t begin, std::size_t end, std::uint32_t* output)
+    {
+        for (std::size_t row = begin; row < end; ++row)
+        {
+            model_vector[row].set_hash_func(hash_function);
+            output[row] = model_vector[row].get_hash();
+        }
+    });
+}
+
+template<typename Hasher>
+PartitionedHashIndex PartitionedHashIndex::hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field, std::size_t threads)
+{
+    std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    return Field::dispatch(field, [&](auto tag) -> PartitionedHashIndex
+    {
+        using F = decltype(tag);
+
+        if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+        {
+            const std::pmr::vector<std::uint16_t>& key_column = model_table.code_column(F::index);
+            const ModelDictionary& dictionary = ModelDictionary::field_dictionary(F::index);
+
+            std::vector<std::uint32_t> code_hashes(dictionary.size());
+
+            for (std::size_t code = 0; code < code_hashes.size(); ++code)
+            {
+                code_hashes[code] = static_cast<std::uint32_t>(hash_function(std::string_view(dictionary.decode(static_cast<std::uint16_t>(code)))));
+            }
+
+            return PartitionedHashIndex::build_rows(hash_column.size(), threads, [&](std::size_t begin, std::size_t end, std::uint32_t* output)
+            {
+                for (std::size_t row = begin; row < end; ++row)
+                {
+                    hash_column[row] = code_hashes[key_column[row]];
+                    output[row] = hash_column[row];
+                }
+            });
+        }
+        else if constexpr (std::is_same_v<F, Field::Date>)
+        {
+            throw std::invalid_argument("field should be a string field");
+        }
+        else
+        {
+            const std::pmr::vector<std::pmr::string>& key_column = model_table.key_column<F>();
+
+            return PartitionedHashIndex::build_rows(hash_column.size(), threads, [&](std::size_t begin, std::size_t end, std::uint32_t* output)
+            {
+                for (std::size_t row = begin; row < end; ++row)
+                {
+                    hash_column[row] = static_cast<std::uint32_t>(hash_function(std::string_view(key_column[row])));
+                    output[row] = hash_column[row];
+                }
+            });
+        }
+    });
+}
+
+#endif // PARTITIONED_INDEX_HPP
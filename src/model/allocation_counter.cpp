@@ -0,0 +1,95 @@
+/**
+ * @file       <allocation_counter.cpp>
+ * @brief      This source file holds implementation of AllocationCounter class.
+ *
+ *             This calss counts heap allocations made through global operator new.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+std::atomic<std::size_t> AllocationCounter::_allocations{0};
+std::atomic<std::size_t> AllocationCounter::_deallocations{0};
+std::atomic<std::size_t> AllocationCounter::_allocated_bytes{0};
+
+void AllocationCounter::reset()
+{
+    AllocationCounter::_allocations.store(0, std::memory_order_relaxed);
+    AllocationCounter::_deallocations.store(0, std::memory_order_relaxed);
+    AllocationCounter::_allocated_bytes.store(0, std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::allocations()
+{
+    return AllocationCounter::_allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::deallocations()
+{
+    return AllocationCounter::_deallocations.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::allocated_bytes()
+{
+    return AllocationCounter::_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+void AllocationCounter::record_allocation(std::size_t size)
+{
+    AllocationCounter::_allocations.fetch_add(1, std::memory_order_relaxed);
+    AllocationCounter::_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationCounter::record_deallocation()
+{
+    AllocationCounter::_deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+#if defined(MODEL_COUNT_ALLOCATIONS)
+/**
+ * Replacement of the global allocation functions.
+ * 
+ * The array, nothrow and sized forms of the standard library forward to these two,
+ * so replacing them is enough to see every allocation of the program.
+ */
+void* operator new(std::size_t size)
+{
+    AllocationCounter::record_allocation(size);
+
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer != nullptr)
+    {
+        AllocationCounter::record_deallocation();
+    }
+
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    ::operator delete(pointer);
+}
+#endif // MODEL_COUNT_ALLOCATIONS
@@ -0,0 +1,91 @@
+/**
+ * @file       <allocation_counter.hpp>
+ * @brief      This header file holds implementation of AllocationCounter class.
+ *
+ *             This calss counts heap allocations made through global operator new.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class AllocationCounter
+ * @brief Counts heap allocations of the whole program.
+ *
+ * When built with MODEL_COUNT_ALLOCATIONS, allocation_counter.cpp replaces the global
+ * operator new and operator delete, so every allocation made by the standard containers
+ * is recorded here. Reset the counter before the code under test and read it afterwards
+ * to see how many allocations it made.
+ *
+ * Without it the global allocation functions are left alone, so the rest of the program
+ * pays no atomic operation per allocation, and every counter stays zero.
+ */
+class AllocationCounter
+{
+public:
+#if defined(MODEL_COUNT_ALLOCATIONS)
+    static constexpr bool enabled = true;      ///< Whether allocations are counted at all.
+#else
+    static constexpr bool enabled = false;     ///< Whether allocations are counted at all.
+#endif
+
+    /**
+     * @brief Resets all counters to zero.
+     */
+    static void reset();
+
+    /**
+     * @brief Gets the number of allocations since the last reset.
+     *
+     * @return The number of allocations.
+     */
+    static std::size_t allocations();
+
+    /**
+     * @brief Gets the number of deallocations since the last reset.
+     *
+     * @return The number of deallocations.
+     */
+    static std::size_t deallocations();
+
+    /**
+     * @brief Gets the number of bytes allocated since the last reset.
+     *
+     * @return The number of bytes.
+     */
+    static std::size_t allocated_bytes();
+
+    /**
+     * @brief Records a single allocation.
+     *
+     * @param size The size of the allocation in bytes.
+     */
+    static void record_allocation(std::size_t size);
+
+    /**
+     * @brief Records a single deallocation.
+     */
+    static void record_deallocation();
+
+private:
+    static std::atomic<std::size_t> _allocations;
+    static std::atomic<std::size_t> _deallocations;
+    static std::atomic<std::size_t> _allocated_bytes;
+};
+
+#endif // ALLOCATION_COUNTER_HPP
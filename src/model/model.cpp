@@ -19,47 +19,245 @@
  */
 #include "model.hpp"
 
-std::uint32_t Hashing::basic_hashing_function(const std::string& value)
+#include <array>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define MODEL_CRC32C_SSE42
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define MODEL_CRC32C_ARM
+#endif
+
+namespace
 {
-    std::uint32_t hash = 0;
+    constexpr std::uint64_t wy_secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+    inline std::uint64_t read_64(const char* data)
+    {
+        std::uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    inline std::uint64_t read_32(const char* data)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Multiplies two 64-bit values into 128 bits, a receives the low half and b the high one.
+     */
+    inline void wy_multiply(std::uint64_t& a, std::uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 uint128_t;
+
+        uint128_t product = static_cast<uint128_t>(a) * b;
+        a = static_cast<std::uint64_t>(product);
+        b = static_cast<std::uint64_t>(product >> 64);
+#else
+        std::uint64_t a_hi = a >> 32, a_lo = static_cast<std::uint32_t>(a);
+        std::uint64_t b_hi = b >> 32, b_lo = static_cast<std::uint32_t>(b);
+        std::uint64_t hh = a_hi * b_hi, hl = a_hi * b_lo, lh = a_lo * b_hi, ll = a_lo * b_lo;
+        std::uint64_t middle = (ll >> 32) + static_cast<std::uint32_t>(hl) + static_cast<std::uint32_t>(lh);
+        a = (middle << 32) | static_cast<std::uint32_t>(ll);
+        b = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+#endif
+    }
+
+    /**
+     * @brief Multiplies two 64-bit values into 128 bits and folds the halves together.
+     */
+    inline std::uint64_t wy_mix(std::uint64_t a, std::uint64_t b)
+    {
+        wy_multiply(a, b);
+        return a ^ b;
+    }
+
+    constexpr std::array<std::uint32_t, 256> make_crc32c_table()
+    {
+        std::array<std::uint32_t, 256> table{};
+
+        for (std::uint32_t index = 0; index < 256; ++index)
+        {
+            std::uint32_t crc = index;
+
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78u : 0u);
+            }
+
+            table[index] = crc;
+        }
+
+        return table;
+    }
+
+    constexpr std::array<std::uint32_t, 256> crc32c_table = make_crc32c_table();
+
+    std::uint32_t crc32c_software(const char* data, std::size_t length, std::uint32_t crc)
+    {
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            crc = crc32c_table[(crc ^ static_cast<std::uint8_t>(data[index])) & 0xFF] ^ (crc >> 8);
+        }
+
+        return crc;
+    }
+
+#if defined(MODEL_CRC32C_SSE42)
+    __attribute__((target("sse4.2")))
+    std::uint32_t crc32c_instruction(const char* data, std::size_t length, std::uint32_t crc)
+    {
+        std::size_t index = 0;
+
+#if defined(__x86_64__)
+        std::uint64_t crc_64 = crc;
+
+        for (; index + 8 <= length; index += 8)
+        {
+            crc_64 = _mm_crc32_u64(crc_64, read_64(data + index));
+        }
+
+        crc = static_cast<std::uint32_t>(crc_64);
+#endif
+
+        for (; index + 4 <= length; index += 4)
+        {
+            crc = _mm_crc32_u32(crc, static_cast<std::uint32_t>(read_32(data + index)));
+        }
 
-    for (char ch : value) 
+        for (; index < length; ++index)
+        {
+            crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(data[index]));
+        }
+
+        return crc;
+    }
+
+    const bool crc32c_hardware_available = __builtin_cpu_supports("sse4.2");
+#elif defined(MODEL_CRC32C_ARM)
+    std::uint32_t crc32c_instruction(const char* data, std::size_t length, std::uint32_t crc)
     {
-        hash = (hash * 31) + static_cast<std::uint32_t>(ch);
+        std::size_t index = 0;
+
+        for (; index + 8 <= length; index += 8)
+        {
+            crc = __crc32cd(crc, read_64(data + index));
+        }
+
+        for (; index + 4 <= length; index += 4)
+        {
+            crc = __crc32cw(crc, static_cast<std::uint32_t>(read_32(data + index)));
+        }
+
+        for (; index < length; ++index)
+        {
+            crc = __crc32cb(crc, static_cast<std::uint8_t>(data[index]));
+        }
+
+        return crc;
     }
 
-    return hash;
+    const bool crc32c_hardware_available = true;
+#endif
 }
 
-std::uint32_t Hashing::djb2_hashing_function(const std::string& value)
+std::uint32_t Hashing::wy_hashing_function(std::string_view value)
 {
-    std::uint32_t hash = 5381; 
+    const char* data = value.data();
+    std::size_t length = value.size();
+
+    std::uint64_t seed = wy_mix(wy_secret[0], wy_secret[1]);
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
 
-    for (char ch : value) 
+    if (length <= 16)
     {
-        hash = ((hash << 5) + hash) ^ static_cast<std::uint32_t>(ch); 
+        if (length >= 4)
+        {
+            std::size_t shift = (length >> 3) << 2;
+
+            a = (read_32(data) << 32) | read_32(data + shift);
+            b = (read_32(data + length - 4) << 32) | read_32(data + length - 4 - shift);
+        }
+        else if (length > 0)
+        {
+            a = (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[0])) << 16) | (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[length >> 1])) << 8) | static_cast<std::uint8_t>(data[length - 1]);
+        }
     }
+    else
+    {
+        std::size_t left = length;
 
-    return hash;
+        if (left > 48)
+        {
+            std::uint64_t seed_1 = seed;
+            std::uint64_t seed_2 = seed;
+
+            do
+            {
+                seed = wy_mix(read_64(data) ^ wy_secret[1], read_64(data + 8) ^ seed);
+                seed_1 = wy_mix(read_64(data + 16) ^ wy_secret[2], read_64(data + 24) ^ seed_1);
+                seed_2 = wy_mix(read_64(data + 32) ^ wy_secret[3], read_64(data + 40) ^ seed_2);
+                data += 48;
+                left -= 48;
+            }
+            while (left > 48);
+
+            seed ^= seed_1 ^ seed_2;
+        }
+
+        while (left > 16)
+        {
+            seed = wy_mix(read_64(data) ^ wy_secret[1], read_64(data + 8) ^ seed);
+            data += 16;
+            left -= 16;
+        }
+
+        a = read_64(data + left - 16);
+        b = read_64(data + left - 8);
+    }
+
+    a ^= wy_secret[1];
+    b ^= seed;
+    wy_multiply(a, b);
+
+    std::uint64_t hash = wy_mix(a ^ wy_secret[0] ^ length, b ^ wy_secret[1]);
+
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
 }
 
-std::uint32_t Hashing::advanced_hashing_function(const std::string& value)
+std::uint32_t Hashing::crc32c_hashing_function(std::string_view value)
 {
-    std::uint32_t hash = 0;
-
-    for(std::size_t i = 0; i < value.length(); i++)
+#if defined(MODEL_CRC32C_SSE42) || defined(MODEL_CRC32C_ARM)
+    if (crc32c_hardware_available)
     {
-        hash = ((((value[i] << 5) + hash) >> 7) * 976531);
+        return ~crc32c_instruction(value.data(), value.size(), 0xFFFFFFFFu);
     }
+#endif
 
-    return (hash & 0x7FFFFFFFFFFFFF);
+    return ~crc32c_software(value.data(), value.size(), 0xFFFFFFFFu);
+}
+
+bool Hashing::crc32c_hardware()
+{
+#if defined(MODEL_CRC32C_SSE42) || defined(MODEL_CRC32C_ARM)
+    return crc32c_hardware_available;
+#else
+    return false;
+#endif
 }
 
 std::uint32_t Hashing::count_collisions(const std::vector<std::list<Model>>& hash_table)
 {
     std::uint32_t collisions = 0;
 
-    for (auto object : hash_table) 
+    for (const auto& object : hash_table)
     {
         if (object.size() > 1)
         {
@@ -70,20 +268,6 @@ std::uint32_t Hashing::count_collisions(const std::vector<std::list<Model>>& has
     return collisions;
 }
 
-std::vector<std::list<Model>> Hashing::hash_model(std::vector<Model>& model_vector, std::function<std::size_t(const std::string& value)> hash_function)
-{
-    std::vector<std::list<Model>> table{model_vector.size()};
-
-    for (std::size_t index = 0; index < model_vector.size(); ++index)
-    {
-        model_vector[index].set_hash_func(hash_function);
-        std::uint32_t hash = model_vector[index].get_hash();
-        table[hash % table.size()].push_back(model_vector[index]);
-    }
-    return table;
-}
-
-
 std::optional<Model> Hashing::Hashing::find_in_hash_table(const std::vector<std::list<Model>>& hash_table, std::uint32_t hash,  std::size_t size)
 {
     std::uint32_t index = hash % size;
@@ -101,27 +285,76 @@ std::optional<Model> Hashing::Hashing::find_in_hash_table(const std::vector<std:
     return std::nullopt;
 }
 
-Model::Model(std::string full_name, std::string department, std::string job_title, std::chrono::year_month_day employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func)
+Model::Model(std::string_view full_name, std::string_view department, std::string_view job_title, ModelDate employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
 {
     this->set_model(full_name, department, job_title, employment_date, model_hash, hash_field, optional_func);
 }
 
-Model::Model(std::string full_name, std::string department, std::string job_title, std::string employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func)
+Model::Model(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
+{
+    this->set_model(full_name, department, job_title, employment_date, model_hash, hash_field, optional_func);
+}
+
+Model::Model(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
 {
     this->set_model(full_name, department, job_title, employment_date, model_hash, hash_field, optional_func);
 }
 
 Model::Model(std::uint8_t decor_type)
 {
+    this->_department = 0;
+    this->_job_title = 0;
     this->set_decor(decor_type);
 }
 
+Model::Model(const allocator_type& allocator) : _full_name(allocator)
+{
+    this->_department = 0;
+    this->_job_title = 0;
+    this->_decor_type = 2;
+    this->_hash_field = 255;
+    this->_model_hash = 0;
+}
+
+Model::Model(const Model& other, const allocator_type& allocator) : _full_name(other._full_name, allocator)
+{
+    this->_department = other._department;
+    this->_job_title = other._job_title;
+    this->_employment_date = other._employment_date;
+    this->_decor_type = other._decor_type;
+    this->_hash_field = other._hash_field;
+    this->_model_hash = other._model_hash;
+}
+
+Model::Model(Model&& other, const allocator_type& allocator) : _full_name(std::move(other._full_name), allocator)
+{
+    this->_department = other._department;
+    this->_job_title = other._job_title;
+    this->_employment_date = other._employment_date;
+    this->_decor_type = other._decor_type;
+    this->_hash_field = other._hash_field;
+    this->_model_hash = other._model_hash;
+}
+
 Model::~Model()
 {
     return;
 }
 
-void Model::set_model(std::string full_name, std::string department, std::string job_title, std::chrono::year_month_day employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func)
+Model::allocator_type Model::get_allocator() const
+{
+    return this->_full_name.get_allocator();
+}
+
+void Model::set_model(std::string_view full_name, std::string_view department, std::string_view job_title, ModelDate employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
+{
+    std::uint16_t department_code = ModelDictionary::department_dictionary().encode(department);
+    std::uint16_t job_title_code  = ModelDictionary::job_title_dictionary().encode(job_title);
+
+    this->set_model(full_name, department_code, job_title_code, employment_date, model_hash, hash_field, optional_func);
+}
+
+void Model::set_model(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
 {
     this->_full_name         = full_name;
     this->_department        = department;
@@ -147,21 +380,16 @@ void Model::set_model(std::string full_name, std::string department, std::string
     }
 }
 
-void Model::set_model(std::string full_name, std::string department, std::string job_title, std::string employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func)
+void Model::set_model(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date, std::uint32_t model_hash, std::uint8_t hash_field, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func)
 {
-    std::vector<std::string> splitted_date;
+    std::optional<ModelDate> parced_employment_date = ModelDate::parse(employment_date);
 
-    std::string buffer;
-
-    for (std::size_t index = 0; index < 3; ++index)
+    if (!parced_employment_date.has_value())
     {
-        splitted_date.push_back(employment_date.substr(0, employment_date.find('/')));
-        employment_date = employment_date.substr(employment_date.find('/') + 1, employment_date.end() - employment_date.begin());
+        throw std::invalid_argument("employment_date should be in YYYY/MM/DD format");
     }
 
-    std::chrono::year_month_day parced_employment_date(std::chrono::year(std::stoi(splitted_date[0])), std::chrono::month(std::stoi(splitted_date[1])), std::chrono::day(std::stoi(splitted_date[2])));
-
-    this->set_model(full_name, department, job_title, parced_employment_date, model_hash, hash_field, optional_func);
+    this->set_model(full_name, department, job_title, parced_employment_date.value(), model_hash, hash_field, optional_func);
 }
 
 void Model::set_decor(std::uint8_t decor_type)
@@ -169,11 +397,6 @@ void Model::set_decor(std::uint8_t decor_type)
     this->_decor_type = decor_type;
 }
 
-void Model::set_hash_func(std::function<std::size_t(const std::string& value)> hash_fucntion)
-{
-    this->_model_hash = hash_fucntion(this->get_field<std::string>(this->_hash_field));
-}
-
 void Model::set_hash(std::uint32_t model_hash)
 {
     this->_model_hash = model_hash;
@@ -212,7 +435,7 @@ ModelComp Model::compare_type(const Model& r_model, std::uint8_t mode)
         }
     case 1:
         {
-            comp_result = this->_department.compare(r_model._department);
+            comp_result = ModelDictionary::department_dictionary().compare(this->_department, r_model._department);
             if (comp_result <= 0)
             {
                 comp_result = 0;
@@ -226,7 +449,7 @@ ModelComp Model::compare_type(const Model& r_model, std::uint8_t mode)
         }
     case 2:
         {
-            comp_result = this->_job_title.compare(r_model._job_title);
+            comp_result = ModelDictionary::job_title_dictionary().compare(this->_job_title, r_model._job_title);
             if (comp_result <= 0)
             {
                 comp_result = 0;
@@ -260,6 +483,29 @@ ModelComp Model::compare_type(const Model& r_model, std::uint8_t mode)
     return model_comp;
 }
 
+std::strong_ordering Model::compare(const Model& l_model, const Model& r_model, std::uint8_t field)
+{
+    return Field::dispatch(field, [&](auto tag)
+    {
+        return Model::compare<decltype(tag)>(l_model, r_model);
+    });
+}
+
+std::strong_ordering Model::compare(const Model& l_model, const Model& r_model, const std::vector<std::uint8_t>& fields)
+{
+    for (std::uint8_t field : fields)
+    {
+        std::strong_ordering result = Model::compare(l_model, r_model, field);
+
+        if (result != 0)
+        {
+            return result;
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
+
 void Model::save_model(const std::vector<Model>& model_vector, std::filesystem::path file_path)
 {
     std::ofstream out(file_path);
@@ -276,12 +522,14 @@ void Model::save_model(const std::vector<Model>& model_vector, std::filesystem::
 
         boost::json::object obj;
 
-        obj.emplace("full_name", model._full_name);
-        obj.emplace("department", model._department);
-        obj.emplace("job_title", model._job_title);
-        obj.emplace("employment_date_year", static_cast<int>(model._employment_date.year()));
-        obj.emplace("employment_date_month", static_cast<unsigned>(model._employment_date.month()));
-        obj.emplace("employment_date_day", static_cast<unsigned>(model._employment_date.day()));
+        obj.emplace("full_name", std::string_view(model._full_name));
+        obj.emplace("department", ModelDictionary::department_dictionary().decode(model._department));
+        obj.emplace("job_title", ModelDictionary::job_title_dictionary().decode(model._job_title));
+        std::chrono::year_month_day employment_date = model._employment_date.to_year_month_day();
+
+        obj.emplace("employment_date_year", static_cast<int>(employment_date.year()));
+        obj.emplace("employment_date_month", static_cast<unsigned>(employment_date.month()));
+        obj.emplace("employment_date_day", static_cast<unsigned>(employment_date.day()));
 
         out << boost::json::serialize(obj);
     }
@@ -290,7 +538,7 @@ void Model::save_model(const std::vector<Model>& model_vector, std::filesystem::
     out.close();
 }
 
-void Model::load_model(std::vector<Model>& model_vector, std::filesystem::path file_path) 
+boost::json::value Model::read_json(const std::filesystem::path& file_path)
 {
     std::ifstream in(file_path, std::ios::binary);
     
@@ -314,26 +562,50 @@ void Model::load_model(std::vector<Model>& model_vector, std::filesystem::path f
 
     in.close();
 
-    boost::json::value value = parser.release();
+    return parser.release();
+}
 
-    boost::json::object obj = value.as_object();
-    boost::json::array rows = obj["model_vecotr"].as_array();
+void Model::load_model(std::vector<Model>& model_vector, std::filesystem::path file_path, std::pmr::memory_resource* resource) 
+{
+    boost::json::value value = Model::read_json(file_path);
+
+    boost::json::object& obj = value.as_object();
+    const boost::json::array& rows = obj["model_vecotr"].as_array();
 
     model_vector.clear();
+    model_vector.reserve(rows.size());
+
     for (const auto& row : rows) 
     {
-        boost::json::object obj = row.as_object();
+        const boost::json::object& obj = row.as_object();
 
-        std::string full_name = obj.at("full_name").as_string().c_str();
-        std::string department = obj.at("department").as_string().c_str();
-        std::string job_title = obj.at("job_title").as_string().c_str();
+        const boost::json::string& full_name = obj.at("full_name").as_string();
+        std::uint16_t department = ModelDictionary::department_dictionary().encode(obj.at("department").as_string().c_str());
+        std::uint16_t job_title = ModelDictionary::job_title_dictionary().encode(obj.at("job_title").as_string().c_str());
         int year = obj.at("employment_date_year").as_int64();
         unsigned month = obj.at("employment_date_month").as_int64();
         unsigned day = obj.at("employment_date_day").as_int64();
 
         std::chrono::year_month_day employment_date = std::chrono::year_month_day(std::chrono::year(year), std::chrono::month(month), std::chrono::day(day));
 
-        model_vector.emplace_back(full_name, department, job_title, employment_date);
+        Model& model = model_vector.emplace_back(allocator_type(resource));
+        model.set_model(std::string_view(full_name.data(), full_name.size()), department, job_title, employment_date);
+    }
+
+    ModelDictionary::department_dictionary().finish();
+    ModelDictionary::job_title_dictionary().finish();
+
+    return;
+}
+
+void Model::copy_model(const std::vector<Model>& source, std::vector<Model>& destination, std::pmr::memory_resource* resource)
+{
+    destination.clear();
+    destination.reserve(source.size());
+
+    for (const Model& model : source)
+    {
+        destination.emplace_back(model, allocator_type(resource));
     }
 
     return;
@@ -381,15 +653,10 @@ std::ostream& operator<< (std::ostream& stream, const Model& model)
         stream << "║ "  << std::setfill(' ') << std::setw(62) 
                    << model._full_name
                    << " ║ " << std::setfill(' ') << std::setw(42)
-                   << model._department
+                   << ModelDictionary::department_dictionary().decode(model._department)
                    << " ║ " << std::setfill(' ') << std::setw(42)
-                   << model._job_title
-                   << " ║ " << std::setfill('0') << std::setw(4)
-                   << static_cast<int>(model._employment_date.year())
-                   << "/"  << std::setfill('0') << std::setw(2)
-                   << static_cast<unsigned>(model._employment_date.month())
-                   << "/"  << std::setfill('0') << std::setw(2)
-                   << static_cast<unsigned>(model._employment_date.day()) << " ║";
+                   << ModelDictionary::job_title_dictionary().decode(model._job_title)
+                   << " ║ " << model._employment_date << " ║";
     }
 
     if (model._decor_type != 1)
@@ -468,14 +735,14 @@ ModelComp operator< (const Model& l_model, const Model& r_model)
         name_comp = 0;
     }
 
-    comp_result = l_model._department.compare(r_model._department);
+    comp_result = ModelDictionary::department_dictionary().compare(l_model._department, r_model._department);
 
     if (comp_result >= 0)
     {
         dept_comp = 0;
     }
 
-    comp_result = l_model._job_title.compare(r_model._job_title);
+    comp_result = ModelDictionary::job_title_dictionary().compare(l_model._job_title, r_model._job_title);
 
     if (comp_result >= 0)
     {
@@ -524,16 +791,12 @@ ModelComp operator== (const Model& l_model, const Model& r_model)
         name_comp = 0;
     }
 
-    comp_result = std::strcmp(l_model._department.c_str(), r_model._department.c_str());
-
-    if (comp_result != 0)
+    if (l_model._department != r_model._department)
     {
         dept_comp = 0;
     }
 
-    comp_result = std::strcmp(l_model._job_title.c_str(), r_model._job_title.c_str());
-
-    if (comp_result != 0)
+    if (l_model._job_title != r_model._job_title)
     {
         jobt_comp = 0;
     }
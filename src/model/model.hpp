@@ -22,6 +22,7 @@
 
 
 #include <chrono>
+#include <compare>
 #include <cstddef>
 #include <cstring> // strcmp has better performance 
 #include <iomanip>
@@ -29,9 +30,12 @@
 #include <optional>
 #include <functional>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -45,16 +49,133 @@
 
 #include "../pseudo_random/pseudo_random.hpp"
 
+#ifndef MODEL_DICTIONARY_HPP
+#include "model_dictionary.hpp"
+#include "model_date.hpp"
+#endif // MODEL_DICTIONARY_HPP
+
+#ifndef RECORD_HPP
+#include "../record/record.hpp"
+#endif // RECORD_HPP
+
 class Model;
+class ModelTable;
 
 
 /**
  * @class Hashing
  * @brief Contains static methods for hashing and related operations.
+ *
+ * The builders take the hash function as a template parameter. Passing one of the
+ * function objects below makes the call a direct one, so the hash loop of a builder
+ * is compiled together with the hash function instead of calling through a pointer
+ * for every key.
  */
 class Hashing
 {
 public:
+    struct Basic
+    {
+        static constexpr std::string_view name = "basic";
+        static constexpr std::uint8_t id = 0;
+
+        std::uint32_t operator()(std::string_view value) const
+        {
+            return Hashing::basic_hashing_function(value);
+        }
+    };  ///< Calls basic_hashing_function.
+
+    struct Djb2
+    {
+        static constexpr std::string_view name = "djb2";
+        static constexpr std::uint8_t id = 1;
+
+        std::uint32_t operator()(std::string_view value) const
+        {
+            return Hashing::djb2_hashing_function(value);
+        }
+    };  ///< Calls djb2_hashing_function.
+
+    struct Advanced
+    {
+        static constexpr std::string_view name = "advanced";
+        static constexpr std::uint8_t id = 2;
+
+        std::uint32_t operator()(std::string_view value) const
+        {
+            return Hashing::advanced_hashing_function(value);
+        }
+    };  ///< Calls advanced_hashing_function.
+
+    struct Wy
+    {
+        static constexpr std::string_view name = "wy";
+        static constexpr std::uint8_t id = 3;
+
+        std::uint32_t operator()(std::string_view value) const
+        {
+            return Hashing::wy_hashing_function(value);
+        }
+    };  ///< Calls wy_hashing_function.
+
+    struct Crc32c
+    {
+        static constexpr std::string_view name = "crc32c";
+        static constexpr std::uint8_t id = 4;
+
+        std::uint32_t operator()(std::string_view value) const
+        {
+            return Hashing::crc32c_hashing_function(value);
+        }
+    };  ///< Calls crc32c_hashing_function.
+
+    static constexpr std::uint8_t function_count = 5;    ///< Number of functions dispatch can select.
+
+    /**
+     * @brief      Converts a runtime function number into a hash function object and
+     *             calls a function with it.
+     *
+     *             The choice is made once here, everything the function does with the
+     *             object is compiled for that hash function. Numbers outside of [0, 4]
+     *             select the basic function. Every object carries its number as `id`.
+     *
+     * @param[in]  hash_function  The function number (0 - basic, 1 - djb2, 2 - advanced, 3 - wy, 4 - crc32c)
+     * @param[in]  function       Callable accepting any hash function object
+     *
+     * @return     Whatever the function returns
+     */
+    template<typename Function>
+        static decltype(auto) dispatch(std::uint8_t hash_function, Function&& function)
+        {
+            switch (hash_function)
+            {
+                case 1:
+                {
+                    return function(Hashing::Djb2{});
+                }
+
+                case 2:
+                {
+                    return function(Hashing::Advanced{});
+                }
+
+                case 3:
+                {
+                    return function(Hashing::Wy{});
+                }
+
+                case 4:
+                {
+                    return function(Hashing::Crc32c{});
+                }
+
+                default:
+                {
+                    return function(Hashing::Basic{});
+                }
+            }
+        }
+
     /**
      * @brief      Basic hashing function for strings.
      *
@@ -62,7 +183,7 @@ public:
      *
      * @return     The hash value
      */
-    static std::uint32_t basic_hashing_function(const std::string& value);
+    static std::uint32_t basic_hashing_function(std::string_view value);
 
     /**
      * @brief      djb2 hashing function for strings.
@@ -71,7 +192,7 @@ public:
      *
      * @return     The hash value
      */
-    static std::uint32_t djb2_hashing_function(const std::string& value);
+    static std::uint32_t djb2_hashing_function(std::string_view value);
 
     /**
      * @brief      Advanced hashing function for strings.
@@ -80,7 +201,39 @@ public:
      *
      * @return     The hash value
      */
-    static std::uint32_t advanced_hashing_function(const std::string& value);
+    static std::uint32_t advanced_hashing_function(std::string_view value);
+
+    /**
+     * @brief      wyhash-style hashing function for strings.
+     *
+     *             Reads the string eight bytes at a time and mixes every 16 bytes with
+     *             a single 64x64->128 bit multiplication. Short keys take one or two
+     *             overlapping reads and no loop at all.
+     *
+     * @param[in]  value  The value to hash
+     *
+     * @return     The hash value
+     */
+    static std::uint32_t wy_hashing_function(std::string_view value);
+
+    /**
+     * @brief      CRC32C (Castagnoli) hashing function for strings.
+     *
+     *             Uses the SSE4.2 crc32 instruction when the CPU has it, the ARMv8 CRC
+     *             extension when the target enables it, and a lookup table otherwise.
+     *
+     * @param[in]  value  The value to hash
+     *
+     * @return     The hash value
+     */
+    static std::uint32_t crc32c_hashing_function(std::string_view value);
+
+    /**
+     * @brief      Check whether crc32c_hashing_function runs on hardware instructions.
+     *
+     * @return     True if a hardware CRC32C instruction is used
+     */
+    static bool crc32c_hardware();
 
     /**
      * @brief      Count the number of collisions in a hash table.
@@ -95,11 +248,12 @@ public:
      * @brief      Hash the models into a hash table.
      *
      * @param[in]  model_vector   The model vector
-     * @param[in]  hash_function  The hash function
+     * @param[in]  hash_function  The hash function, callable with a std::string_view
      *
      * @return     The hash table
      */
-    static std::vector<std::list<Model>> hash_model(std::vector<Model>& model_vector, std::function<std::size_t(const std::string& value)> hash_function);
+    template<typename Hasher>
+        static std::vector<std::list<Model>> hash_model(std::vector<Model>& model_vector, Hasher&& hash_function);
 
     /**
      * @brief      Find a model in a hash table.
@@ -111,8 +265,136 @@ public:
      * @return     The model if found, otherwise an empty optional
      */
     static std::optional<Model> find_in_hash_table(const std::vector<std::list<Model>>& hash_table, std::uint32_t hash, std::size_t size);
+
+    /**
+     * @brief      Count the number of collisions in a hash table of row indices.
+     *
+     * @param[in]  hash_table  The hash table
+     *
+     * @return     The number of collisions
+     */
+    static std::uint32_t count_collisions(const std::vector<std::list<std::uint32_t>>& hash_table);
+
+    /**
+     * @brief      Hash the rows of a model table into a hash table of row indices.
+     *
+     *             Only the key column and the hash column of the table are touched.
+     *
+     * @param[in]  model_table    The model table
+     * @param[in]  hash_function  The hash function, callable with a std::string_view
+     * @param[in]  field          The field to hash (0 - full name, 1 - department, 2 - job title)
+     *
+     * @return     The hash table
+     *
+     * @throws     std::invalid_argument If the field is the employment date
+     */
+    template<typename Hasher>
+        static std::vector<std::list<std::uint32_t>> hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field = 0);
+
+    /**
+     * @brief      Fill the hash column of a model table.
+     *
+     *             Department and job title hash every dictionary string once and copy
+     *             the hash of the code to every row.
+     *
+     * @param[in]  model_table    The model table
+     * @param[in]  hash_function  The hash function, callable with a std::string_view
+     * @param[in]  field          The field to hash (0 - full name, 1 - department, 2 - job title)
+     *
+     * @throws     std::invalid_argument If the field is the employment date
+     */
+    template<typename Hasher>
+        static void hash_rows(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field = 0);
+
+    /**
+     * @brief      Find a row in a hash table of row indices.
+     *
+     * @param[in]  hash_table   The hash table
+     * @param[in]  model_table  The model table the hash table was built from
+     * @param[in]  hash         The hash value
+     *
+     * @return     The row index if found, otherwise an empty optional
+     */
+    static std::optional<std::size_t> find_in_hash_table(const std::vector<std::list<std::uint32_t>>& hash_table, const ModelTable& model_table, std::uint32_t hash);
 };
 
+/**
+ * @namespace Field
+ * @brief Compile-time tags of the Model fields.
+ * 
+ * Algorithms templated on a tag resolve the field at compile time, so their inner
+ * loops contain neither a switch on the field number nor a type check.
+ */
+namespace Field
+{
+    /**
+     * @brief Common part of the field tags, makes every tag a RecordSchema field.
+     * 
+     * @tparam Self The tag itself.
+     * @tparam Index The field number.
+     */
+    template<typename Self, std::uint8_t Index>
+        struct FieldTag
+        {
+            static constexpr std::uint8_t index = Index;
+
+            template<typename Record>
+                static decltype(auto) get(const Record& record)
+                {
+                    return record.template get_field<Self>();
+                }
+
+            template<typename Record>
+                static auto key(const Record& record)
+                {
+                    return record.template get_key<Self>();
+                }
+        };
+
+    struct Name       : FieldTag<Name, 0>       { static constexpr std::string_view name = "full_name"; };         ///< Full name.
+    struct Department : FieldTag<Department, 1> { static constexpr std::string_view name = "department"; };        ///< Department.
+    struct JobTitle   : FieldTag<JobTitle, 2>   { static constexpr std::string_view name = "job_title"; };         ///< Job title.
+    struct Date       : FieldTag<Date, 3>       { static constexpr std::string_view name = "employment_date"; };   ///< Employment date.
+
+    /**
+     * @brief Converts a runtime field number into a field tag and calls a function with it.
+     * 
+     * Numbers outside of [0, 3] select the full name, same as Model::compare_type does.
+     * 
+     * @tparam Function Callable accepting any field tag.
+     * @param field The field number.
+     * @param function The function to call.
+     * 
+     * @return Whatever the function returns.
+     */
+    template<typename Function>
+        decltype(auto) dispatch(std::uint8_t field, Function&& function)
+        {
+            switch (field)
+            {
+                case 1:
+                {
+                    return function(Field::Department{});
+                }
+
+                case 2:
+                {
+                    return function(Field::JobTitle{});
+                }
+
+                case 3:
+                {
+                    return function(Field::Date{});
+                }
+
+                default:
+                {
+                    return function(Field::Name{});
+                }
+            }
+        }
+}
+
 class ModelComp;
 
 /**
@@ -121,10 +403,20 @@ class ModelComp;
  * 
  * The Model class represents an employee with attributes such as full name, department, job title,
  * employment date, model hash, and hash field.
+ * 
+ * Department and job title are stored as ModelDictionary codes and are only expanded back
+ * to strings when they are printed, saved or explicitly requested.
+ * 
+ * The full name is a std::pmr::string. A model built with an allocator keeps every later
+ * name from that allocator's memory resource, so a whole dataset can be carved from one
+ * arena and freed in one shot.
  */
 class Model
 {
 public:
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+    using schema = RecordSchema<Field::Name, Field::Department, Field::JobTitle, Field::Date>;
+
    /**
      * @brief Constructor for the Model class.
      * 
@@ -136,7 +428,7 @@ public:
      * @param hash_field The hash field of the model.
      * @param optional_func An optional hash function for the model.
      */
-    Model(std::string full_name, std::string department, std::string job_title, std::chrono::year_month_day employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func = std::nullopt);
+    Model(std::string_view full_name, std::string_view department, std::string_view job_title, ModelDate employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
     
     /**
      * @brief Constructor for the Model class.
@@ -149,7 +441,20 @@ public:
      * @param hash_field The hash field of the model.
      * @param optional_func An optional hash function for the model.
      */
-    Model(std::string full_name, std::string department, std::string job_title, std::string employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func = std::nullopt);
+    Model(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
+
+    /**
+     * @brief Constructor for the Model class.
+     * 
+     * @param full_name The full name of the model.
+     * @param department The department code in ModelDictionary::department_dictionary().
+     * @param job_title The job title code in ModelDictionary::job_title_dictionary().
+     * @param employment_date The employment date of the model.
+     * @param model_hash The hash value of the model.
+     * @param hash_field The hash field of the model.
+     * @param optional_func An optional hash function for the model.
+     */
+    Model(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
     
     /**
      * @brief Constructor for the Model class.
@@ -158,33 +463,73 @@ public:
      */
     Model(std::uint8_t decor_type);
 
+    /**
+     * @brief Constructor for the Model class, creates an empty model.
+     * 
+     * @param allocator The allocator used for the full name.
+     */
+    explicit Model(const allocator_type& allocator);
+
+    /**
+     * @brief Allocator-extended copy constructor for the Model class.
+     * 
+     * @param other The other model to be copied.
+     * @param allocator The allocator used for the full name.
+     */
+    Model(const Model& other, const allocator_type& allocator);
+
+    /**
+     * @brief Allocator-extended move constructor for the Model class.
+     * 
+     * @param other The other model to be moved from.
+     * @param allocator The allocator used for the full name.
+     */
+    Model(Model&& other, const allocator_type& allocator);
+
     /**
      * @brief Copy constructor for the Model class.
      * 
      * @param other The other model to be copied.
      */
-    Model(const Model& other) {
-        try 
-        {
-            this->_full_name = other._full_name;
-            this->_department = other._department;
-            this->_job_title = other._job_title;
-            this->_employment_date = other._employment_date;
-            this->_decor_type = other._decor_type;
-            this->_hash_field = other._hash_field;
-            this->_model_hash = other._model_hash;
-        } 
-        catch (const std::exception& e) 
-        {
-            std::cout << e.what() << std::endl;
-        }
-    }
+    Model(const Model& other) = default;
+
+    /**
+     * @brief Move constructor for the Model class.
+     * 
+     * @param other The other model to be moved from.
+     */
+    Model(Model&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the Model class.
+     * 
+     * @param other The other model to be copied.
+     * 
+     * @return Reference to this model.
+     */
+    Model& operator= (const Model& other) = default;
+
+    /**
+     * @brief Move assignment operator for the Model class.
+     * 
+     * @param other The other model to be moved from.
+     * 
+     * @return Reference to this model.
+     */
+    Model& operator= (Model&& other) = default;
 
     /**
      * @brief Destructor for the Model class.
      */
     ~Model();
 
+    /**
+     * @brief Gets the allocator of the model.
+     * 
+     * @return The allocator used for the full name.
+     */
+    allocator_type get_allocator() const;
+
     /**
      * @brief Sets the properties of the model.
      * 
@@ -196,7 +541,7 @@ public:
      * @param hash_field The hash field of the model.
      * @param optional_func An optional hash function for the model.
      */
-    void set_model(std::string full_name, std::string department, std::string job_title, std::chrono::year_month_day employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func = std::nullopt);
+    void set_model(std::string_view full_name, std::string_view department, std::string_view job_title, ModelDate employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
     
     /**
      * @brief Sets the properties of the model.
@@ -209,7 +554,20 @@ public:
      * @param hash_field The hash field of the model.
      * @param optional_func An optional hash function for the model.
      */
-    void set_model(std::string full_name, std::string department, std::string job_title, std::string employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::size_t(const std::string& value)>>& optional_func = std::nullopt);
+    void set_model(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
+
+    /**
+     * @brief Sets the properties of the model.
+     * 
+     * @param full_name The full name of the model.
+     * @param department The department code in ModelDictionary::department_dictionary().
+     * @param job_title The job title code in ModelDictionary::job_title_dictionary().
+     * @param employment_date The employment date of the model.
+     * @param model_hash The hash value of the model.
+     * @param hash_field The hash field of the model.
+     * @param optional_func An optional hash function for the model.
+     */
+    void set_model(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date, std::uint32_t model_hash = 0, std::uint8_t hash_field = 255, const std::optional<std::function<std::uint32_t(std::string_view value)>>& optional_func = std::nullopt);
     
     /**
      * @brief Sets the decoration type of the model.
@@ -219,11 +577,12 @@ public:
     void set_decor(std::uint8_t decor_type);
 
     /**
-     * @brief Sets the hash function for the model.
+     * @brief Hashes the hash field of the model with the given function.
      * 
-     * @param hash_function The hash function to be set.
+     * @param hash_function The hash function, callable with a std::string_view.
      */
-    void set_hash_func(std::function<std::size_t(const std::string& value)> hash_fucntion);
+    template<typename Hasher>
+        void set_hash_func(Hasher&& hash_fucntion);
 
     /**
      * @brief Sets the hash value for the model.
@@ -307,6 +666,91 @@ public:
     template<typename T>
         T get_hash_field() const;
 
+    /**
+     * @brief Gets the value of a field selected at compile time.
+     * 
+     * @tparam F The field tag.
+     * 
+     * @return Reference to the full name, department, job title or employment date.
+     */
+    template<typename F>
+        decltype(auto) get_field() const;
+
+    /**
+     * @brief Sets the value of a field selected at compile time.
+     * 
+     * @tparam F The field tag.
+     * @tparam T The type of the value.
+     * @param value The value to set.
+     */
+    template<typename F, typename T>
+        void set_field(T&& value);
+
+    /**
+     * @brief Gets the comparison key of a field selected at compile time.
+     * 
+     * Keys of two models compare exactly like the fields themselves. Department and
+     * job title keys are dictionary ranks, so comparing them does not touch any string.
+     * 
+     * @tparam F The field tag.
+     * 
+     * @return The comparison key.
+     */
+    template<typename F>
+        auto get_key() const;
+
+    /**
+     * @brief Converts a search value into the comparison key of a field.
+     * 
+     * @tparam F The field tag.
+     * @tparam T The type of the value.
+     * @param value The value to convert.
+     * 
+     * @return The key, or an empty optional if no model can hold this value.
+     * 
+     * @throws std::invalid_argument If the value type does not match the field.
+     */
+    template<typename F, typename T>
+        static auto make_key(const T& value);
+
+    /**
+     * @brief Three-way compares models by one or more fields selected at compile time.
+     * 
+     * Fields are compared left to right and the first one that differs decides the
+     * result, the remaining fields are not touched.
+     * 
+     * @tparam F The tag of the first field.
+     * @tparam Fs The tags of the tie-breaking fields.
+     * @param l_model The left model.
+     * @param r_model The right model.
+     * 
+     * @return The ordering of the left model relative to the right one.
+     */
+    template<typename F, typename... Fs>
+        static std::strong_ordering compare(const Model& l_model, const Model& r_model);
+
+    /**
+     * @brief Three-way compares models by a field selected at runtime.
+     * 
+     * @param l_model The left model.
+     * @param r_model The right model.
+     * @param field The field identifier.
+     * 
+     * @return The ordering of the left model relative to the right one.
+     */
+    static std::strong_ordering compare(const Model& l_model, const Model& r_model, std::uint8_t field);
+
+    /**
+     * @brief Lexicographically compares models by a list of fields selected at runtime.
+     * 
+     * @param l_model The left model.
+     * @param r_model The right model.
+     * @param fields The field identifiers, most significant first.
+     * 
+     * @return The ordering of the left model relative to the right one.
+     */
+    static std::strong_ordering compare(const Model& l_model, const Model& r_model, const std::vector<std::uint8_t>& fields);
+
     /**
      * @brief Saves the model vector to a file.
      * 
@@ -320,8 +764,21 @@ public:
      * 
      * @param model_vector The vector to load the models into.
      * @param file_path The path of the file to load from.
+     * @param resource The memory resource for the names of the loaded models.
      */
-    static void load_model(std::vector<Model>& model_vector, std::filesystem::path file_path);
+    static void load_model(std::vector<Model>& model_vector, std::filesystem::path file_path, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Copies models into another vector, allocating their names from a memory resource.
+     * 
+     * The destination is cleared first, so its old models give their memory back
+     * to their resource before the copies are made.
+     * 
+     * @param source The models to copy.
+     * @param destination The vector to copy the models into.
+     * @param resource The memory resource for the names of the copies.
+     */
+    static void copy_model(const std::vector<Model>& source, std::vector<Model>& destination, std::pmr::memory_resource* resource);
 
     /**
      * @brief Prints the models in the model vector.
@@ -400,11 +857,16 @@ public:
      */
     friend ModelComp     operator!= (const Model& l_model, const Model& r_model);
 
+    friend class ModelTable;
+    friend class ModelBatch;
+
 private:
-    std::string                     _full_name;
-    std::string                     _department;
-    std::string                     _job_title;
-    std::chrono::year_month_day     _employment_date;
+    static boost::json::value read_json(const std::filesystem::path& file_path);
+
+    std::pmr::string                _full_name;
+    std::uint16_t                   _department;
+    std::uint16_t                   _job_title;
+    ModelDate                       _employment_date;
 
     std::uint8_t                    _decor_type;
 
@@ -568,7 +1030,7 @@ ModelComp Model::compare_type(std::uint8_t mode, T r_value)
     {
     case 0:
         {
-            if (std::is_same<T, decltype(this->_full_name)>::value)
+            if (std::is_same<T, std::string>::value)
             {
                 comp_result = this->_full_name.compare(r_value);
                 if (comp_result < 0)
@@ -593,9 +1055,9 @@ ModelComp Model::compare_type(std::uint8_t mode, T r_value)
         }
     case 1:
         {
-            if (std::is_same<T, decltype(this->_department)>::value)
+            if (std::is_same<T, std::string>::value)
             {
-                comp_result = this->_department.compare(r_value);
+                comp_result = ModelDictionary::department_dictionary().decode(this->_department).compare(r_value);
                 if (comp_result < 0)
                 {
                     comp_result = 1;
@@ -618,9 +1080,9 @@ ModelComp Model::compare_type(std::uint8_t mode, T r_value)
         }
     case 2:
         {
-            if (std::is_same<T, decltype(this->_job_title)>::value)
+            if (std::is_same<T, std::string>::value)
             {
-                comp_result = this->_job_title.compare(r_value);
+                comp_result = ModelDictionary::job_title_dictionary().decode(this->_job_title).compare(r_value);
                 if (comp_result < 0)
                 {
                     comp_result = 1;
@@ -664,9 +1126,9 @@ T Model::get_field(std::uint8_t field) const
     {
         
         case 1:
-        {   if (std::is_same<T, decltype(this->_department)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
-                return this->_department;
+                return ModelDictionary::department_dictionary().decode(this->_department);
             }
             else 
             {
@@ -676,9 +1138,9 @@ T Model::get_field(std::uint8_t field) const
         }
 
         case 2:
-        {   if (std::is_same<T, decltype(this->_job_title)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
-                return this->_job_title;
+                return ModelDictionary::job_title_dictionary().decode(this->_job_title);
             }
             else 
             {
@@ -694,9 +1156,9 @@ T Model::get_field(std::uint8_t field) const
         }
 
         default:
-        {   if (std::is_same<T, decltype(this->_full_name)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
-                return this->_full_name;
+                return std::string(this->_full_name);
             }
             else 
             {
@@ -716,9 +1178,9 @@ void Model::set_field(std::uint8_t field, T value)
     {
         
         case 1:
-        {   if (std::is_same<T, decltype(this->_department)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
-                this->_department = value;
+                this->_department = ModelDictionary::department_dictionary().encode(value);
             }
             else 
             {
@@ -728,9 +1190,9 @@ void Model::set_field(std::uint8_t field, T value)
         }
 
         case 2:
-        {   if (std::is_same<T, decltype(this->_job_title)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
-                this->_job_title = value;
+                this->_job_title = ModelDictionary::job_title_dictionary().encode(value);
             }
             else 
             {
@@ -746,7 +1208,7 @@ void Model::set_field(std::uint8_t field, T value)
         }
 
         default:
-        {   if (std::is_same<T, decltype(this->_full_name)>::value)
+        {   if (std::is_same<T, std::string>::value)
             {
                 this->_full_name = value;
             }
@@ -766,4 +1228,197 @@ T Model::get_hash_field() const
     return this->get_field<T>(this->_hash_field);
 }
 
+template<typename F>
+decltype(auto) Model::get_field() const
+{
+    if constexpr (std::is_same_v<F, Field::Department>)
+    {
+        return static_cast<const std::string&>(ModelDictionary::department_dictionary().decode(this->_department));
+    }
+    else if constexpr (std::is_same_v<F, Field::JobTitle>)
+    {
+        return static_cast<const std::string&>(ModelDictionary::job_title_dictionary().decode(this->_job_title));
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        return static_cast<const ModelDate&>(this->_employment_date);
+    }
+    else
+    {
+        return static_cast<const std::pmr::string&>(this->_full_name);
+    }
+}
+
+template<typename F, typename T>
+void Model::set_field(T&& value)
+{
+    if constexpr (std::is_same_v<F, Field::Department>)
+    {
+        this->_department = ModelDictionary::department_dictionary().encode(value);
+    }
+    else if constexpr (std::is_same_v<F, Field::JobTitle>)
+    {
+        this->_job_title = ModelDictionary::job_title_dictionary().encode(value);
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        this->_employment_date = std::forward<T>(value);
+    }
+    else
+    {
+        this->_full_name = std::forward<T>(value);
+    }
+}
+
+template<typename F>
+auto Model::get_key() const
+{
+    if constexpr (std::is_same_v<F, Field::Department>)
+    {
+        return ModelDictionary::department_dictionary().rank(this->_department);
+    }
+    else if constexpr (std::is_same_v<F, Field::JobTitle>)
+    {
+        return ModelDictionary::job_title_dictionary().rank(this->_job_title);
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        return this->_employment_date;
+    }
+    else
+    {
+        return std::string_view(this->_full_name);
+    }
+}
+
+template<typename F, typename T>
+auto Model::make_key(const T& value)
+{
+    using key_type = decltype(std::declval<const Model&>().get_key<F>());
+
+    std::optional<key_type> key;
+
+    if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+    {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        {
+            const ModelDictionary& dictionary = ModelDictionary::field_dictionary(F::index);
+            std::optional<std::uint16_t> code = dictionary.find(value);
+
+            if (code.has_value())
+            {
+                key = dictionary.rank(code.value());
+            }
+        }
+        else
+        {
+            throw std::invalid_argument("value should be a string");
+        }
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        if constexpr (std::is_convertible_v<const T&, ModelDate>)
+        {
+            key = ModelDate(value);
+        }
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        {
+            key = ModelDate::parse(value);
+        }
+        else
+        {
+            throw std::invalid_argument("value should be _employment_date");
+        }
+    }
+    else
+    {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        {
+            key = std::string_view(value);
+        }
+        else
+        {
+            throw std::invalid_argument("value should be _full_name");
+        }
+    }
+
+    return key;
+}
+
+template<typename F, typename... Fs>
+std::strong_ordering Model::compare(const Model& l_model, const Model& r_model)
+{
+    return Records::compare<F, Fs...>(l_model, r_model);
+}
+
+template<typename Hasher>
+void Model::set_hash_func(Hasher&& hash_fucntion)
+{
+    this->_model_hash = Field::dispatch(this->_hash_field, [&](auto tag) -> std::uint32_t
+    {
+        if constexpr (std::is_same_v<decltype(tag), Field::Date>)
+        {
+            return static_cast<std::uint32_t>(hash_fucntion(std::string_view(this->get_field<std::string>(Field::Date::index))));
+        }
+        else
+        {
+            return static_cast<std::uint32_t>(hash_fucntion(std::string_view(this->get_field<decltype(tag)>())));
+        }
+    });
+}
+
+/**
+ * The three short hash functions live in the header, so a builder instantiated with
+ * Hashing::Basic, Hashing::Djb2 or Hashing::Advanced gets them inlined into its loop.
+ */
+inline std::uint32_t Hashing::basic_hashing_function(std::string_view value)
+{
+    std::uint32_t hash = 0;
+
+    for (char ch : value) 
+    {
+        hash = (hash * 31) + static_cast<std::uint32_t>(ch);
+    }
+
+    return hash;
+}
+
+inline std::uint32_t Hashing::djb2_hashing_function(std::string_view value)
+{
+    std::uint32_t hash = 5381; 
+
+    for (char ch : value) 
+    {
+        hash = ((hash << 5) + hash) ^ static_cast<std::uint32_t>(ch); 
+    }
+
+    return hash;
+}
+
+inline std::uint32_t Hashing::advanced_hashing_function(std::string_view value)
+{
+    std::uint32_t hash = 0;
+
+    for(std::size_t i = 0; i < value.length(); i++)
+    {
+        hash = ((((value[i] << 5) + hash) >> 7) * 976531);
+    }
+
+    return (hash & 0x7FFFFFFFFFFFFF);
+}
+
+template<typename Hasher>
+std::vector<std::list<Model>> Hashing::hash_model(std::vector<Model>& model_vector, Hasher&& hash_function)
+{
+    std::vector<std::list<Model>> table{model_vector.size()};
+
+    for (std::size_t index = 0; index < model_vector.size(); ++index)
+    {
+        model_vector[index].set_hash_func(hash_function);
+        std::uint32_t hash = model_vector[index].get_hash();
+        table[hash % table.size()].push_back(model_vector[index]);
+    }
+    return table;
+}
+
 #endif // MODEL_HPP
\ No newline at end of file
@@ -0,0 +1,169 @@
+/**
+ * @file       <model_batch.cpp>
+ * @brief      This source file holds implementation of ModelBatch class.
+ *
+ *             This calss implements bulk builder of columnar model tables.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "model_batch.hpp"
+
+namespace
+{
+    /**
+     * @brief Creates an arena large enough for the columns and names of a batch.
+     *
+     * @param capacity The expected number of rows.
+     * @param name_length The expected average length of a full name.
+     *
+     * @return The arena.
+     */
+    std::shared_ptr<std::pmr::memory_resource> make_arena(std::size_t capacity, std::size_t name_length)
+    {
+        std::size_t row_size = sizeof(std::pmr::string) + name_length + 1 + 2 * sizeof(std::uint16_t) + sizeof(ModelDate) + sizeof(std::uint32_t);
+
+        return std::make_shared<std::pmr::monotonic_buffer_resource>(std::max<std::size_t>(capacity * row_size, 1024));
+    }
+}
+
+ModelBatch::ModelBatch(std::size_t capacity, std::size_t name_length)
+{
+    this->_name_length = name_length;
+    this->_table.emplace(make_arena(capacity, name_length));
+    this->_table->reserve(capacity);
+}
+
+ModelBatch::~ModelBatch()
+{
+    return;
+}
+
+void ModelBatch::reserve(std::size_t capacity)
+{
+    this->_table->reserve(capacity);
+}
+
+void ModelBatch::append(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date)
+{
+    this->_table->_full_name.emplace_back(full_name);
+    this->_table->_department.push_back(department);
+    this->_table->_job_title.push_back(job_title);
+    this->_table->_employment_date.push_back(employment_date);
+    this->_table->_model_hash.push_back(0);
+}
+
+void ModelBatch::append(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date)
+{
+    std::optional<ModelDate> parced_employment_date = ModelDate::parse(employment_date);
+
+    if (!parced_employment_date.has_value())
+    {
+        throw std::invalid_argument("employment_date should be in YYYY/MM/DD format");
+    }
+
+    this->append(full_name, ModelDictionary::department_dictionary().encode(department), ModelDictionary::job_title_dictionary().encode(job_title), parced_employment_date.value());
+}
+
+void ModelBatch::append_columns(std::span<const std::string_view> full_names, std::span<const std::string_view> departments, std::span<const std::string_view> job_titles, std::span<const std::string_view> employment_dates)
+{
+    const std::size_t rows = full_names.size();
+
+    if (departments.size() != rows || job_titles.size() != rows || employment_dates.size() != rows)
+    {
+        throw std::invalid_argument("columns should have the same number of rows");
+    }
+
+    ModelTable& table = this->_table.value();
+    const std::size_t first_row = table.size();
+
+    table.reserve(first_row + rows);
+
+    try
+    {
+        ModelDate::parse_column(employment_dates, table._employment_date);
+    }
+    catch (...)
+    {
+        table._employment_date.resize(first_row);
+        throw;
+    }
+
+    ModelDictionary& department_dictionary = ModelDictionary::department_dictionary();
+    ModelDictionary& job_title_dictionary = ModelDictionary::job_title_dictionary();
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        table._full_name.emplace_back(full_names[row]);
+        table._department.push_back(department_dictionary.encode(departments[row]));
+        table._job_title.push_back(job_title_dictionary.encode(job_titles[row]));
+        table._model_hash.push_back(0);
+    }
+
+    department_dictionary.finish();
+    job_title_dictionary.finish();
+}
+
+void ModelBatch::append(const Model& model)
+{
+    this->_table->push_back(model);
+}
+
+void ModelBatch::load(std::filesystem::path file_path)
+{
+    boost::json::value value = Model::read_json(file_path);
+
+    const boost::json::array& rows = value.as_object().at("model_vecotr").as_array();
+
+    this->reserve(this->size() + rows.size());
+
+    for (const auto& row : rows)
+    {
+        const boost::json::object& obj = row.as_object();
+
+        const boost::json::string& full_name = obj.at("full_name").as_string();
+        std::uint16_t department = ModelDictionary::department_dictionary().encode(obj.at("department").as_string().c_str());
+        std::uint16_t job_title = ModelDictionary::job_title_dictionary().encode(obj.at("job_title").as_string().c_str());
+        int year = obj.at("employment_date_year").as_int64();
+        unsigned month = obj.at("employment_date_month").as_int64();
+        unsigned day = obj.at("employment_date_day").as_int64();
+
+        this->append(std::string_view(full_name.data(), full_name.size()), department, job_title, std::chrono::year_month_day(std::chrono::year(year), std::chrono::month(month), std::chrono::day(day)));
+    }
+
+    ModelDictionary::department_dictionary().finish();
+    ModelDictionary::job_title_dictionary().finish();
+}
+
+std::size_t ModelBatch::size() const
+{
+    return this->_table->size();
+}
+
+std::size_t ModelBatch::capacity() const
+{
+    return this->_table->_full_name.capacity();
+}
+
+ModelTable ModelBatch::finish()
+{
+    ModelDictionary::department_dictionary().finish();
+    ModelDictionary::job_title_dictionary().finish();
+
+    ModelTable table = std::move(this->_table.value());
+
+    this->_table.emplace(make_arena(table.size(), this->_name_length));
+    this->_table->reserve(table.size());
+
+    return table;
+}
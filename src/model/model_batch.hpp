@@ -0,0 +1,145 @@
+/**
+ * @file       <model_batch.hpp>
+ * @brief      This header file holds implementation of ModelBatch class.
+ *
+ *             This calss implements bulk builder of columnar model tables.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MODEL_BATCH_HPP
+#define MODEL_BATCH_HPP
+
+#ifndef MODEL_TABLE_HPP
+#include "model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+
+/**
+ * @class ModelBatch
+ * @brief Appends rows straight into the columns of a ModelTable.
+ *
+ * The batch allocates one arena sized for the expected number of rows and reserves every
+ * column in it up front, so appending a row never constructs a Model and never calls the
+ * global allocator. Names are copied into the arena one after another, which keeps them
+ * contiguous in memory. finish() hands the table over together with the arena.
+ */
+class ModelBatch
+{
+public:
+    /**
+     * @brief Constructor for the ModelBatch class.
+     *
+     * @param capacity The expected number of rows.
+     * @param name_length The expected average length of a full name.
+     */
+    explicit ModelBatch(std::size_t capacity, std::size_t name_length = 32);
+
+    /**
+     * @brief Destructor for the ModelBatch class.
+     */
+    ~ModelBatch();
+
+    /**
+     * @brief Reserves room for more rows in every column.
+     *
+     * @param capacity The total number of rows.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Appends a row of already encoded values.
+     *
+     * @param full_name The full name.
+     * @param department The department code in ModelDictionary::department_dictionary().
+     * @param job_title The job title code in ModelDictionary::job_title_dictionary().
+     * @param employment_date The employment date.
+     */
+    void append(std::string_view full_name, std::uint16_t department, std::uint16_t job_title, ModelDate employment_date);
+
+    /**
+     * @brief Appends a row of raw strings.
+     *
+     * @param full_name The full name.
+     * @param department The department.
+     * @param job_title The job title.
+     * @param employment_date The employment date in "YYYY/MM/DD" format.
+     *
+     * @throws std::invalid_argument If the employment date can not be parsed.
+     */
+    void append(std::string_view full_name, std::string_view department, std::string_view job_title, std::string_view employment_date);
+
+    /**
+     * @brief Appends columns of raw strings, one row per position.
+     *
+     * The dates are parsed as a whole column first, so a malformed date leaves the
+     * batch unchanged.
+     *
+     * @param full_names The full names.
+     * @param departments The departments.
+     * @param job_titles The job titles.
+     * @param employment_dates The employment dates in "YYYY/MM/DD" format.
+     *
+     * @throws std::invalid_argument If the columns differ in length or any employment date can not be parsed.
+     */
+    void append_columns(std::span<const std::string_view> full_names, std::span<const std::string_view> departments, std::span<const std::string_view> job_titles, std::span<const std::string_view> employment_dates);
+
+    /**
+     * @brief Appends a copy of a model.
+     *
+     * @param model The model to append.
+     */
+    void append(const Model& model);
+
+    /**
+     * @brief Appends every model stored in a file written by Model::save_model.
+     *
+     * @param file_path The path of the file to load from.
+     */
+    void load(std::filesystem::path file_path);
+
+    /**
+     * @brief Gets the number of appended rows.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the number of rows that fit without reallocating the columns.
+     *
+     * @return The capacity of the batch.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Hands the built table over, the table keeps the arena alive.
+     *
+     * The batch is empty afterwards and may be used to build the next table.
+     *
+     * @return The table holding every appended row.
+     */
+    ModelTable finish();
+
+private:
+    std::size_t                 _name_length;
+    std::optional<ModelTable>   _table;       ///< Rebuilt with a fresh arena by every finish().
+};
+
+#endif // MODEL_BATCH_HPP
@@ -0,0 +1,154 @@
+/**
+ * @file       <model_date.cpp>
+ * @brief      This source file holds implementation of ModelDate class.
+ *
+ *             This calss implements packed serial-day date used by Model.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "model_date.hpp"
+
+#include <iomanip>
+
+namespace
+{
+    /**
+     * @brief Packs validated calendar fields into a date.
+     *
+     * @param year The year.
+     * @param month The month.
+     * @param day The day.
+     *
+     * @return The date, or an empty optional if the fields do not form a valid date.
+     */
+    std::optional<ModelDate> make_date(int year, unsigned month, unsigned day)
+    {
+        // std::chrono::month and std::chrono::day keep only the low byte, so out of range
+        // fields would wrap into a valid date without this check.
+        if (year < -32767 || year > 32767 || month < 1 || month > 12 || day < 1 || day > 31)
+        {
+            return std::nullopt;
+        }
+
+        std::chrono::year_month_day date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+
+        if (!date.ok())
+        {
+            return std::nullopt;
+        }
+
+        return ModelDate(date);
+    }
+}
+
+ModelDate::ModelDate()
+{
+    this->_days = 0;
+}
+
+ModelDate::ModelDate(const std::chrono::year_month_day& date)
+{
+    this->_days = std::chrono::sys_days(date).time_since_epoch().count();
+}
+
+ModelDate ModelDate::from_days(std::int32_t days)
+{
+    ModelDate date;
+    date._days = days;
+
+    return date;
+}
+
+std::int32_t ModelDate::days() const
+{
+    return this->_days;
+}
+
+std::chrono::year_month_day ModelDate::to_year_month_day() const
+{
+    return std::chrono::year_month_day(std::chrono::sys_days(std::chrono::days(this->_days)));
+}
+
+ModelDate::operator std::chrono::year_month_day() const
+{
+    return this->to_year_month_day();
+}
+
+std::optional<ModelDate> ModelDate::parse(std::string_view value)
+{
+    if (value.size() == 10 && value[4] == '/' && value[7] == '/')
+    {
+        const unsigned y0 = static_cast<unsigned char>(value[0]) - '0';
+        const unsigned y1 = static_cast<unsigned char>(value[1]) - '0';
+        const unsigned y2 = static_cast<unsigned char>(value[2]) - '0';
+        const unsigned y3 = static_cast<unsigned char>(value[3]) - '0';
+        const unsigned m0 = static_cast<unsigned char>(value[5]) - '0';
+        const unsigned m1 = static_cast<unsigned char>(value[6]) - '0';
+        const unsigned d0 = static_cast<unsigned char>(value[8]) - '0';
+        const unsigned d1 = static_cast<unsigned char>(value[9]) - '0';
+
+        // Characters below '0' wrap around, so a single unsigned check per digit is enough.
+        const bool invalid = (y0 > 9) | (y1 > 9) | (y2 > 9) | (y3 > 9) | (m0 > 9) | (m1 > 9) | (d0 > 9) | (d1 > 9);
+
+        if (invalid)
+        {
+            return std::nullopt;
+        }
+
+        return make_date(y0 * 1000 + y1 * 100 + y2 * 10 + y3, m0 * 10 + m1, d0 * 10 + d1);
+    }
+
+    int year = 0;
+    unsigned month = 0;
+    unsigned day = 0;
+
+    const char* end = value.data() + value.size();
+
+    auto [year_end, year_error] = std::from_chars(value.data(), end, year);
+
+    if (year_error != std::errc() || year_end == end || *year_end != '/')
+    {
+        return std::nullopt;
+    }
+
+    auto [month_end, month_error] = std::from_chars(year_end + 1, end, month);
+
+    if (month_error != std::errc() || month_end == end || *month_end != '/')
+    {
+        return std::nullopt;
+    }
+
+    auto [day_end, day_error] = std::from_chars(month_end + 1, end, day);
+
+    if (day_error != std::errc() || day_end != end)
+    {
+        return std::nullopt;
+    }
+
+    return make_date(year, month, day);
+}
+
+std::ostream& operator<< (std::ostream& stream, const ModelDate& date)
+{
+    std::chrono::year_month_day calendar_date = date.to_year_month_day();
+
+    stream << std::setfill('0') << std::setw(4)
+           << static_cast<int>(calendar_date.year())
+           << "/"  << std::setfill('0') << std::setw(2)
+           << static_cast<unsigned>(calendar_date.month())
+           << "/"  << std::setfill('0') << std::setw(2)
+           << static_cast<unsigned>(calendar_date.day());
+
+    return stream;
+}
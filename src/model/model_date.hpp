@@ -0,0 +1,162 @@
+/**
+ * @file       <model_date.hpp>
+ * @brief      This header file holds implementation of ModelDate class.
+ *
+ *             This calss implements packed serial-day date used by Model.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MODEL_DATE_HPP
+#define MODEL_DATE_HPP
+
+#include <charconv>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ModelDate
+ * @brief Calendar date packed into a single 32-bit serial day number.
+ *
+ * The value is the number of days since 1970/01/01, same as std::chrono::sys_days,
+ * so two dates compare with a single integer comparison instead of the field by
+ * field comparison of std::chrono::year_month_day.
+ */
+class ModelDate
+{
+public:
+    /**
+     * @brief Constructor for the ModelDate class, holds 1970/01/01.
+     */
+    ModelDate();
+
+    /**
+     * @brief Constructor for the ModelDate class.
+     *
+     * @param date The calendar date to pack.
+     */
+    ModelDate(const std::chrono::year_month_day& date);
+
+    /**
+     * @brief Creates a date from a serial day number.
+     *
+     * @param days The number of days since 1970/01/01.
+     *
+     * @return The date.
+     */
+    static ModelDate from_days(std::int32_t days);
+
+    /**
+     * @brief Gets the serial day number of the date.
+     *
+     * @return The number of days since 1970/01/01.
+     */
+    std::int32_t days() const;
+
+    /**
+     * @brief Unpacks the date into calendar fields.
+     *
+     * @return The calendar date.
+     */
+    std::chrono::year_month_day to_year_month_day() const;
+
+    /**
+     * @brief Implicit conversion to std::chrono::year_month_day.
+     */
+    operator std::chrono::year_month_day() const;
+
+    /**
+     * @brief Parses a date in "YYYY/MM/DD" format.
+     *
+     * Zero padded dates take a fixed-width path without any loop or allocation,
+     * dates with one-digit month or day ("YYYY/M/D") are parsed with std::from_chars.
+     *
+     * @param value The string to parse.
+     *
+     * @return The date, or an empty optional if the string is not a valid date.
+     */
+    static std::optional<ModelDate> parse(std::string_view value);
+
+    /**
+     * @brief Parses a whole column of date strings.
+     *
+     * @tparam Range Any iterable range of values convertible to std::string_view.
+     * @tparam Dates A vector of ModelDate, std::vector or std::pmr::vector.
+     * @param values The strings to parse.
+     * @param dates The vector the parsed dates are appended to.
+     *
+     * @throws std::invalid_argument If any of the strings is not a valid date.
+     */
+    template<typename Range, typename Dates>
+        static void parse_column(const Range& values, Dates& dates);
+
+    /**
+     * @brief Compares two dates by their serial day numbers.
+     */
+    auto operator<=> (const ModelDate& r_date) const = default;
+
+    /**
+     * @brief Overloading the << operator for ModelDate class, prints "YYYY/MM/DD".
+     *
+     * @param stream The output stream.
+     * @param date The date to be output.
+     *
+     * @return The output stream after printing the date.
+     */
+    friend std::ostream& operator<< (std::ostream& stream, const ModelDate& date);
+
+private:
+    std::int32_t _days;
+};
+
+template<typename Range, typename Dates>
+void ModelDate::parse_column(const Range& values, Dates& dates)
+{
+    if constexpr (requires { std::size(values); })
+    {
+        dates.reserve(dates.size() + std::size(values));
+    }
+
+    for (const auto& value : values)
+    {
+        std::optional<ModelDate> date = ModelDate::parse(value);
+
+        if (!date.has_value())
+        {
+            throw std::invalid_argument("value should be a date in YYYY/MM/DD format");
+        }
+
+        dates.push_back(date.value());
+    }
+}
+
+/**
+ * @brief Hashes a date through its serial day number.
+ */
+template<>
+struct std::hash<ModelDate>
+{
+    std::size_t operator()(const ModelDate& date) const noexcept
+    {
+        return std::hash<std::int32_t>{}(date.days());
+    }
+};
+
+#endif // MODEL_DATE_HPP
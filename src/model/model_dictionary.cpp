@@ -0,0 +1,176 @@
+/**
+ * @file       <model_dictionary.cpp>
+ * @brief      This source file holds implementation of ModelDictionary class.
+ *
+ *             This calss implements interned, order-preserving string dictionary used by Model.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "model_dictionary.hpp"
+
+ModelDictionary::ModelDictionary()
+{
+    return;
+}
+
+ModelDictionary::~ModelDictionary()
+{
+    return;
+}
+
+std::uint16_t ModelDictionary::encode(std::string_view value)
+{
+    std::optional<std::uint16_t> code = this->find(value);
+
+    if (code.has_value())
+    {
+        return code.value();
+    }
+
+    std::uint16_t new_code = this->intern(value);
+
+    // The value is new, so it takes the rank of the next greater value, or the last rank.
+    auto next = std::next(this->_codes.find(value));
+    std::uint16_t new_rank = (next == this->_codes.end()) ? new_code : this->_ranks[next->second];
+
+    this->insert_rank(new_code, new_rank);
+
+    return new_code;
+}
+
+void ModelDictionary::finish()
+{
+    if (this->_perfect_codes.size() != this->_values.size())
+    {
+        this->rebuild_index();
+    }
+}
+
+std::optional<std::uint16_t> ModelDictionary::find(std::string_view value) const
+{
+    if (this->_perfect_codes.size() != this->_values.size())
+    {
+        auto iterator = this->_codes.find(value);
+
+        if (iterator == this->_codes.end())
+        {
+            return std::nullopt;
+        }
+
+        return iterator->second;
+    }
+
+    if (this->_perfect_codes.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::uint16_t code = this->_perfect_codes[this->_perfect_hash.index(value)];
+
+    if (this->_values[code] != value)
+    {
+        return std::nullopt;
+    }
+
+    return code;
+}
+
+const std::string& ModelDictionary::decode(std::uint16_t code) const
+{
+    return this->_values[code];
+}
+
+std::size_t ModelDictionary::size() const
+{
+    return this->_values.size();
+}
+
+ModelDictionary& ModelDictionary::field_dictionary(std::uint8_t field)
+{
+    switch (field)
+    {
+        case 1:
+        {
+            return ModelDictionary::department_dictionary();
+        }
+
+        case 2:
+        {
+            return ModelDictionary::job_title_dictionary();
+        }
+
+        default:
+        {
+            throw std::invalid_argument("field should be _department or _job_title");
+        }
+    }
+}
+
+std::uint16_t ModelDictionary::intern(std::string_view value)
+{
+    auto iterator = this->_codes.find(value);
+
+    if (iterator != this->_codes.end())
+    {
+        return iterator->second;
+    }
+
+    if (this->_values.size() > std::numeric_limits<std::uint16_t>::max())
+    {
+        throw std::length_error("ModelDictionary can not hold more than 65536 values");
+    }
+
+    std::uint16_t code = this->_values.size();
+
+    this->_values.emplace_back(value);
+    this->_codes.emplace(this->_values.back(), code);
+
+    return code;
+}
+
+void ModelDictionary::rebuild_ranks()
+{
+    std::uint16_t rank = 0;
+
+    this->_ranks.resize(this->_values.size());
+
+    for (const auto& [value, code] : this->_codes)
+    {
+        this->_ranks[code] = rank++;
+    }
+}
+
+void ModelDictionary::insert_rank(std::uint16_t code, std::uint16_t rank)
+{
+    for (std::uint16_t& other_rank : this->_ranks)
+    {
+        other_rank += (other_rank >= rank);
+    }
+
+    this->_ranks.resize(this->_values.size());
+    this->_ranks[code] = rank;
+}
+
+void ModelDictionary::rebuild_index()
+{
+    std::vector<std::string_view> values(this->_values.begin(), this->_values.end());
+
+    this->_perfect_hash.build(values);
+    this->_perfect_codes.resize(values.size());
+
+    for (std::size_t code = 0; code < values.size(); ++code)
+    {
+        this->_perfect_codes[this->_perfect_hash.index(values[code])] = static_cast<std::uint16_t>(code);
+    }
+}
@@ -0,0 +1,213 @@
+/**
+ * @file       <model_dictionary.hpp>
+ * @brief      This header file holds implementation of ModelDictionary class.
+ *
+ *             This calss implements interned, order-preserving string dictionary used by Model.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MODEL_DICTIONARY_HPP
+#define MODEL_DICTIONARY_HPP
+
+#ifndef PERFECT_HASH_HPP
+#include "perfect_hash.hpp"
+#endif // PERFECT_HASH_HPP
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ModelDictionary
+ * @brief Interns strings of a low-cardinality field into 16-bit codes.
+ *
+ * Every distinct string is stored once and is identified by a stable 16-bit code.
+ * Alongside the codes the dictionary keeps a rank table, so that
+ * `rank(l_code) < rank(r_code)` exactly when `decode(l_code) < decode(r_code)`.
+ * Dictionaries seeded with seed() assign codes in sorted order, so for seeded values
+ * the code itself already matches the string order.
+ *
+ * Lookups go through a minimal perfect hash of the interned strings: one probe gives the
+ * only candidate code, and one string comparison confirms it. Interning a new string
+ * only updates the rank table, lookups fall back to the sorted map until finish()
+ * rebuilds the perfect hash, so loading many new strings costs one rebuild.
+ */
+class ModelDictionary
+{
+public:
+    /**
+     * @brief Constructor for the ModelDictionary class.
+     */
+    ModelDictionary();
+
+    /**
+     * @brief Destructor for the ModelDictionary class.
+     */
+    ~ModelDictionary();
+
+    /**
+     * @brief Interns all values of a list in sorted order.
+     *
+     * @tparam Range Any iterable range of values convertible to std::string_view.
+     * @param values The values to intern.
+     */
+    template<typename Range>
+        void seed(const Range& values);
+
+    /**
+     * @brief Gets the code of a value, interning it if it is not present yet.
+     *
+     * @param value The value to encode.
+     *
+     * @return The code of the value.
+     */
+    std::uint16_t encode(std::string_view value);
+
+    /**
+     * @brief Rebuilds the perfect hash after new values were encoded.
+     *
+     * Call it once a load is done, find() goes through the sorted map until then.
+     * Does nothing if no value was interned since the last rebuild.
+     */
+    void finish();
+
+    /**
+     * @brief Gets the code of a value without interning it.
+     *
+     * @param value The value to look up.
+     *
+     * @return The code if the value is present, otherwise an empty optional.
+     */
+    std::optional<std::uint16_t> find(std::string_view value) const;
+
+    /**
+     * @brief Gets the string behind a code.
+     *
+     * @param code The code to decode.
+     *
+     * @return The interned string. The reference stays valid for the dictionary lifetime.
+     */
+    const std::string& decode(std::uint16_t code) const;
+
+    /**
+     * @brief Gets the order-preserving rank of a code.
+     *
+     * @param code The code.
+     *
+     * @return The position of the decoded string among all interned strings.
+     */
+    std::uint16_t rank(std::uint16_t code) const;
+
+    /**
+     * @brief Compares the strings behind two codes without touching the strings.
+     *
+     * @param l_code The left code.
+     * @param r_code The right code.
+     *
+     * @return -1, 0 or 1, same sign as std::string::compare would give.
+     */
+    int compare(std::uint16_t l_code, std::uint16_t r_code) const;
+
+    /**
+     * @brief Gets the number of interned strings.
+     *
+     * @return The number of interned strings.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the dictionary shared by all department fields.
+     *
+     * @return The department dictionary.
+     */
+    static ModelDictionary& department_dictionary();
+
+    /**
+     * @brief Gets the dictionary shared by all job title fields.
+     *
+     * @return The job title dictionary.
+     */
+    static ModelDictionary& job_title_dictionary();
+
+    /**
+     * @brief Gets the dictionary of a dictionary encoded Model field.
+     *
+     * @param field The field identifier (1 - department, 2 - job title).
+     *
+     * @return The dictionary of the field.
+     */
+    static ModelDictionary& field_dictionary(std::uint8_t field);
+
+private:
+    std::uint16_t intern(std::string_view value);
+    void rebuild_ranks();
+    void insert_rank(std::uint16_t code, std::uint16_t rank);
+    void rebuild_index();
+
+    std::deque<std::string>                                 _values;    ///< Interned strings indexed by code.
+    std::vector<std::uint16_t>                              _ranks;     ///< Order-preserving ranks indexed by code.
+    std::map<std::string, std::uint16_t, std::less<>>       _codes;     ///< Sorted lookup from string to code.
+    PerfectHash                                             _perfect_hash;
+    std::vector<std::uint16_t>                              _perfect_codes; ///< Codes indexed by perfect hash position, stale while shorter than _values.
+};
+
+template<typename Range>
+void ModelDictionary::seed(const Range& values)
+{
+    std::set<std::string_view> sorted_values(std::begin(values), std::end(values));
+
+    for (std::string_view value : sorted_values)
+    {
+        this->intern(value);
+    }
+
+    this->rebuild_ranks();
+    this->rebuild_index();
+}
+
+/**
+ * rank, compare and the shared dictionaries are defined here, so that key extraction
+ * in the sorting loops compiles down to a table load instead of two calls per key.
+ */
+inline std::uint16_t ModelDictionary::rank(std::uint16_t code) const
+{
+    return this->_ranks[code];
+}
+
+inline int ModelDictionary::compare(std::uint16_t l_code, std::uint16_t r_code) const
+{
+    return (this->_ranks[l_code] > this->_ranks[r_code]) - (this->_ranks[l_code] < this->_ranks[r_code]);
+}
+
+inline ModelDictionary& ModelDictionary::department_dictionary()
+{
+    static ModelDictionary dictionary;
+    return dictionary;
+}
+
+inline ModelDictionary& ModelDictionary::job_title_dictionary()
+{
+    static ModelDictionary dictionary;
+    return dictionary;
+}
+
+#endif // MODEL_DICTIONARY_HPP
@@ -0,0 +1,115 @@
+/**
+ * @file       <model_key.cpp>
+ * @brief      This source file holds implementation of ModelKey and ModelKeyEncoder classes.
+ *
+ *             This calss implements normalized fixed-width sort keys for Model objects.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "model_key.hpp"
+
+ModelKeyEncoder::ModelKeyEncoder(std::vector<std::uint8_t> fields)
+{
+    if (fields.empty())
+    {
+        throw std::invalid_argument("fields should not be empty");
+    }
+
+    this->_fields = std::move(fields);
+    this->_exact = true;
+
+    std::size_t offset = 0;
+
+    for (std::uint8_t field : this->_fields)
+    {
+        std::size_t width = (field == 1 || field == 2) ? 2 : (field == 3) ? 4 : 0;
+
+        if (width == 0 || offset + width > sizeof(key_bytes))
+        {
+            this->_exact = false;
+            break;
+        }
+
+        offset += width;
+    }
+}
+
+ModelKey ModelKeyEncoder::encode(const Model& model, std::uint32_t row) const
+{
+    key_bytes bytes{};
+    std::size_t offset = 0;
+
+    for (std::uint8_t field : this->_fields)
+    {
+        if (offset >= bytes.size())
+        {
+            break;
+        }
+
+        offset = Field::dispatch(field, [&](auto tag)
+        {
+            return ModelKeyEncoder::write_key<decltype(tag)>(bytes, offset, model.get_key<decltype(tag)>());
+        });
+    }
+
+    return ModelKeyEncoder::make_key(bytes, row);
+}
+
+std::vector<ModelKey> ModelKeyEncoder::encode(const std::vector<Model>& model_vector) const
+{
+    std::vector<ModelKey> keys;
+    keys.reserve(model_vector.size());
+
+    for (std::size_t index = 0; index < model_vector.size(); ++index)
+    {
+        keys.push_back(this->encode(model_vector[index], index));
+    }
+
+    return keys;
+}
+
+std::strong_ordering ModelKeyEncoder::compare(const ModelKey& l_key, const ModelKey& r_key, const std::vector<Model>& model_vector) const
+{
+    std::strong_ordering result = ModelKey::compare(l_key, r_key);
+
+    if (result != 0 || this->_exact)
+    {
+        return result;
+    }
+
+    return Model::compare(model_vector[l_key.row], model_vector[r_key.row], this->_fields);
+}
+
+bool ModelKeyEncoder::exact() const
+{
+    return this->_exact;
+}
+
+const std::vector<std::uint8_t>& ModelKeyEncoder::fields() const
+{
+    return this->_fields;
+}
+
+ModelKey ModelKeyEncoder::make_key(const key_bytes& bytes, std::uint32_t row)
+{
+    ModelKey key{0, 0, row};
+
+    for (std::size_t index = 0; index < 8; ++index)
+    {
+        key.hi = (key.hi << 8) | bytes[index];
+        key.lo = (key.lo << 8) | bytes[index + 8];
+    }
+
+    return key;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file       <model_key.hpp>
+ * @brief      This header file holds implementation of ModelKey and ModelKeyEncoder classes.
+ *
+ *             This calss implements normalized fixed-width sort keys for Model objects.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MODEL_KEY_HPP
+#define MODEL_KEY_HPP
+
+#ifndef MODEL_HPP
+#include "model.hpp"
+#endif // MODEL_HPP
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @struct ModelKey
+ * @brief Normalized 128-bit sort key of a single model.
+ *
+ * The selected fields are written big-endian into 16 bytes, so comparing (hi, lo)
+ * as two unsigned integers gives the same order as comparing the fields themselves,
+ * up to the length of the stored name prefix.
+ */
+struct ModelKey
+{
+    std::uint64_t   hi;     ///< First eight bytes of the key.
+    std::uint64_t   lo;     ///< Last eight bytes of the key.
+    std::uint32_t   row;    ///< Index of the model the key was built from.
+
+    /**
+     * @brief Compares the key bytes of two keys, the row index is ignored.
+     *
+     * @param l_key The left key.
+     * @param r_key The right key.
+     *
+     * @return The ordering of the left key relative to the right one.
+     */
+    static std::strong_ordering compare(const ModelKey& l_key, const ModelKey& r_key)
+    {
+        if (l_key.hi != r_key.hi)
+        {
+            return l_key.hi <=> r_key.hi;
+        }
+
+        return l_key.lo <=> r_key.lo;
+    }
+};
+
+/**
+ * @class ModelKeyEncoder
+ * @brief Builds ModelKey objects for a list of fields.
+ *
+ * Department and job title take two bytes (their dictionary rank), the employment
+ * date takes four bytes (the biased serial day number) and the full name takes every
+ * byte that is left. Fields after the name do not fit into the key and are only
+ * compared on ties, same as names longer than the stored prefix.
+ */
+class ModelKeyEncoder
+{
+public:
+    /**
+     * @brief Constructor for the ModelKeyEncoder class.
+     *
+     * @param fields The field identifiers, most significant first.
+     */
+    explicit ModelKeyEncoder(std::vector<std::uint8_t> fields);
+
+    /**
+     * @brief Builds the key of a model.
+     *
+     * @param model The model.
+     * @param row The index stored in the key.
+     *
+     * @return The key.
+     */
+    ModelKey encode(const Model& model, std::uint32_t row) const;
+
+    /**
+     * @brief Builds the keys of every model of a vector.
+     *
+     * @param model_vector The models.
+     *
+     * @return The keys, key `index` is built from model `index`.
+     */
+    std::vector<ModelKey> encode(const std::vector<Model>& model_vector) const;
+
+    /**
+     * @brief Builds the key of a search value for the first field of the encoder.
+     *
+     * Only meaningful for encoders built for a single field.
+     *
+     * @tparam T The type of the search value.
+     * @param value The search value.
+     *
+     * @return The key, or an empty optional if no model can hold this value.
+     */
+    template<typename T>
+        std::optional<ModelKey> encode_value(const T& value) const;
+
+    /**
+     * @brief Compares two models through their keys.
+     *
+     * The full field comparison is only performed when the keys are equal and the
+     * encoder is not exact.
+     *
+     * @param l_key The key of the left model.
+     * @param r_key The key of the right model.
+     * @param model_vector The models the keys were built from.
+     *
+     * @return The ordering of the left model relative to the right one.
+     */
+    std::strong_ordering compare(const ModelKey& l_key, const ModelKey& r_key, const std::vector<Model>& model_vector) const;
+
+    /**
+     * @brief Checks whether equal keys always mean equal fields.
+     *
+     * @return True if no field is truncated or left out of the key.
+     */
+    bool exact() const;
+
+    /**
+     * @brief Gets the fields of the encoder.
+     *
+     * @return The field identifiers, most significant first.
+     */
+    const std::vector<std::uint8_t>& fields() const;
+
+private:
+    using key_bytes = std::array<std::uint8_t, 16>;
+
+    template<typename F, typename K>
+        static std::size_t write_key(key_bytes& bytes, std::size_t offset, const K& key);
+
+    static ModelKey make_key(const key_bytes& bytes, std::uint32_t row);
+
+    std::vector<std::uint8_t>   _fields;
+    bool                        _exact;
+};
+
+template<typename T>
+std::optional<ModelKey> ModelKeyEncoder::encode_value(const T& value) const
+{
+    return Field::dispatch(this->_fields.front(), [&](auto tag) -> std::optional<ModelKey>
+    {
+        auto key = Model::make_key<decltype(tag)>(value);
+
+        if (!key.has_value())
+        {
+            return std::nullopt;
+        }
+
+        key_bytes bytes{};
+        ModelKeyEncoder::write_key<decltype(tag)>(bytes, 0, key.value());
+
+        return ModelKeyEncoder::make_key(bytes, 0);
+    });
+}
+
+template<typename F, typename K>
+std::size_t ModelKeyEncoder::write_key(key_bytes& bytes, std::size_t offset, const K& key)
+{
+    if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+    {
+        if (offset + 2 > bytes.size())
+        {
+            return bytes.size();
+        }
+
+        bytes[offset]     = static_cast<std::uint8_t>(key >> 8);
+        bytes[offset + 1] = static_cast<std::uint8_t>(key);
+
+        return offset + 2;
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        if (offset + 4 > bytes.size())
+        {
+            return bytes.size();
+        }
+
+        // Flipping the sign bit maps signed day numbers onto the same unsigned order.
+        std::uint32_t days = static_cast<std::uint32_t>(key.days()) ^ 0x80000000u;
+
+        bytes[offset]     = static_cast<std::uint8_t>(days >> 24);
+        bytes[offset + 1] = static_cast<std::uint8_t>(days >> 16);
+        bytes[offset + 2] = static_cast<std::uint8_t>(days >> 8);
+        bytes[offset + 3] = static_cast<std::uint8_t>(days);
+
+        return offset + 4;
+    }
+    else
+    {
+        std::size_t length = std::min(key.size(), bytes.size() - offset);
+
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            bytes[offset + index] = static_cast<std::uint8_t>(key[index]);
+        }
+
+        return bytes.size();
+    }
+}
+
+#endif // MODEL_KEY_HPP
@@ -0,0 +1,336 @@
+/**
+ * @file       <model_table.cpp>
+ * @brief      This source file holds implementation of ModelTable class.
+ *
+ *             This calss implements columnar (struct-of-arrays) storage for Model objects.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "model_table.hpp"
+
+ModelRow::ModelRow(const ModelTable& table, std::size_t index)
+{
+    this->_table = &table;
+    this->_index = index;
+}
+
+const std::pmr::string& ModelRow::full_name() const
+{
+    return this->_table->name_column()[this->_index];
+}
+
+const std::string& ModelRow::department() const
+{
+    return ModelDictionary::department_dictionary().decode(this->_table->code_column(1)[this->_index]);
+}
+
+const std::string& ModelRow::job_title() const
+{
+    return ModelDictionary::job_title_dictionary().decode(this->_table->code_column(2)[this->_index]);
+}
+
+const ModelDate& ModelRow::employment_date() const
+{
+    return this->_table->date_column()[this->_index];
+}
+
+std::uint32_t ModelRow::get_hash() const
+{
+    return this->_table->hash_column()[this->_index];
+}
+
+std::size_t ModelRow::get_index() const
+{
+    return this->_index;
+}
+
+std::string_view ModelRow::get_field(std::uint8_t field) const
+{
+    switch (field)
+    {
+        case 1:
+        {
+            return this->department();
+        }
+
+        case 2:
+        {
+            return this->job_title();
+        }
+
+        case 3:
+        {
+            throw std::invalid_argument("field should not be _employment_date");
+        }
+
+        default:
+        {
+            return this->full_name();
+        }
+    }
+}
+
+Model ModelRow::to_model() const
+{
+    return Model(this->full_name(), this->_table->code_column(1)[this->_index], this->_table->code_column(2)[this->_index], this->employment_date(), this->get_hash(), 0);
+}
+
+ModelRow::operator Model() const
+{
+    return this->to_model();
+}
+
+std::ostream& operator<< (std::ostream& stream, const ModelRow& row)
+{
+    stream << row.to_model();
+
+    return stream;
+}
+
+ModelTable::ModelTable()
+{
+    return;
+}
+
+ModelTable::ModelTable(const std::vector<Model>& model_vector)
+{
+    this->reserve(model_vector.size());
+
+    for (const Model& model : model_vector)
+    {
+        this->push_back(model);
+    }
+}
+
+ModelTable::ModelTable(std::shared_ptr<std::pmr::memory_resource> resource) : 
+    _resource(std::move(resource)),
+    _full_name(_resource.get()),
+    _department(_resource.get()),
+    _job_title(_resource.get()),
+    _employment_date(_resource.get()),
+    _model_hash(_resource.get())
+{
+    return;
+}
+
+ModelTable::ModelTable(const ModelTable& other) : 
+    _full_name(other._full_name),
+    _department(other._department),
+    _job_title(other._job_title),
+    _employment_date(other._employment_date),
+    _model_hash(other._model_hash)
+{
+    return;
+}
+
+ModelTable& ModelTable::operator= (const ModelTable& other)
+{
+    this->_full_name = other._full_name;
+    this->_department = other._department;
+    this->_job_title = other._job_title;
+    this->_employment_date = other._employment_date;
+    this->_model_hash = other._model_hash;
+
+    return *this;
+}
+
+ModelTable& ModelTable::operator= (ModelTable&& other)
+{
+    this->_full_name = std::move(other._full_name);
+    this->_department = std::move(other._department);
+    this->_job_title = std::move(other._job_title);
+    this->_employment_date = std::move(other._employment_date);
+    this->_model_hash = std::move(other._model_hash);
+
+    return *this;
+}
+
+ModelTable::~ModelTable()
+{
+    return;
+}
+
+void ModelTable::reserve(std::size_t capacity)
+{
+    this->_full_name.reserve(capacity);
+    this->_department.reserve(capacity);
+    this->_job_title.reserve(capacity);
+    this->_employment_date.reserve(capacity);
+    this->_model_hash.reserve(capacity);
+}
+
+void ModelTable::push_back(const Model& model)
+{
+    this->_full_name.emplace_back(model._full_name);
+    this->_department.push_back(model._department);
+    this->_job_title.push_back(model._job_title);
+    this->_employment_date.push_back(model._employment_date);
+    this->_model_hash.push_back(model._model_hash);
+}
+
+void ModelTable::clear()
+{
+    this->_full_name.clear();
+    this->_department.clear();
+    this->_job_title.clear();
+    this->_employment_date.clear();
+    this->_model_hash.clear();
+}
+
+std::size_t ModelTable::size() const
+{
+    return this->_full_name.size();
+}
+
+bool ModelTable::empty() const
+{
+    return this->_full_name.empty();
+}
+
+ModelRow ModelTable::operator[] (std::size_t index) const
+{
+    return ModelRow(*this, index);
+}
+
+ModelRow ModelTable::at(std::size_t index) const
+{
+    if (index >= this->size())
+    {
+        throw std::out_of_range("ModelTable row index is out of range");
+    }
+
+    return ModelRow(*this, index);
+}
+
+std::vector<Model> ModelTable::to_vector() const
+{
+    std::vector<Model> model_vector;
+    model_vector.reserve(this->size());
+
+    for (std::size_t index = 0; index < this->size(); ++index)
+    {
+        model_vector.push_back((*this)[index].to_model());
+    }
+
+    return model_vector;
+}
+
+const std::pmr::vector<std::pmr::string>& ModelTable::name_column() const
+{
+    return this->_full_name;
+}
+
+const std::pmr::vector<std::uint16_t>& ModelTable::code_column(std::uint8_t field) const
+{
+    switch (field)
+    {
+        case 1:
+        {
+            return this->_department;
+        }
+
+        case 2:
+        {
+            return this->_job_title;
+        }
+
+        default:
+        {
+            throw std::invalid_argument("field should be _department or _job_title");
+        }
+    }
+}
+
+std::vector<std::uint16_t> ModelTable::rank_column(std::uint8_t field) const
+{
+    const std::pmr::vector<std::uint16_t>& codes = this->code_column(field);
+    const ModelDictionary& dictionary = ModelDictionary::field_dictionary(field);
+
+    std::vector<std::uint16_t> ranks(codes.size());
+
+    for (std::size_t index = 0; index < codes.size(); ++index)
+    {
+        ranks[index] = dictionary.rank(codes[index]);
+    }
+
+    return ranks;
+}
+
+const std::pmr::vector<ModelDate>& ModelTable::date_column() const
+{
+    return this->_employment_date;
+}
+
+const std::pmr::vector<std::uint32_t>& ModelTable::hash_column() const
+{
+    return this->_model_hash;
+}
+
+std::pmr::vector<std::uint32_t>& ModelTable::hash_column()
+{
+    return this->_model_hash;
+}
+
+void ModelTable::permute(const std::vector<std::uint32_t>& order)
+{
+    if (order.size() != this->size())
+    {
+        throw std::invalid_argument("order should have exactly one entry per row");
+    }
+
+    ModelTable::permute_column(this->_full_name, order);
+    ModelTable::permute_column(this->_department, order);
+    ModelTable::permute_column(this->_job_title, order);
+    ModelTable::permute_column(this->_employment_date, order);
+    ModelTable::permute_column(this->_model_hash, order);
+}
+
+void ModelTable::print_table(const ModelTable& model_table)
+{
+    Model::print_model(model_table.to_vector());
+}
+
+std::uint32_t Hashing::count_collisions(const std::vector<std::list<std::uint32_t>>& hash_table)
+{
+    std::uint32_t collisions = 0;
+
+    for (const auto& object : hash_table)
+    {
+        if (object.size() > 1)
+        {
+            collisions += (object.size() - 1);
+        }
+    }
+
+    return collisions;
+}
+
+std::optional<std::size_t> Hashing::find_in_hash_table(const std::vector<std::list<std::uint32_t>>& hash_table, const ModelTable& model_table, std::uint32_t hash)
+{
+    if (hash_table.empty())
+    {
+        return std::nullopt;
+    }
+
+    const std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    for (std::uint32_t row : hash_table[hash % hash_table.size()])
+    {
+        if (hash_column[row] == hash)
+        {
+            return row;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,446 @@
+/**
+ * @file       <model_table.hpp>
+ * @brief      This header file holds implementation of ModelTable class.
+ *
+ *             This calss implements columnar (struct-of-arrays) storage for Model objects.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef MODEL_TABLE_HPP
+#define MODEL_TABLE_HPP
+
+#ifndef MODEL_HPP
+#include "model.hpp"
+#endif // MODEL_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+class ModelTable;
+
+/**
+ * @class ModelRow
+ * @brief Lightweight read-only view of a single row of a ModelTable.
+ *
+ * The view holds only a pointer to the table and a row index, so it is cheap to copy.
+ * It can be converted to a Model when a full object is required.
+ */
+class ModelRow
+{
+public:
+    /**
+     * @brief Constructor for the ModelRow class.
+     *
+     * @param table The table the row belongs to.
+     * @param index The index of the row in the table.
+     */
+    ModelRow(const ModelTable& table, std::size_t index);
+
+    /**
+     * @brief Gets the full name of the row.
+     *
+     * @return The full name.
+     */
+    const std::pmr::string& full_name() const;
+
+    /**
+     * @brief Gets the department of the row.
+     *
+     * @return The department.
+     */
+    const std::string& department() const;
+
+    /**
+     * @brief Gets the job title of the row.
+     *
+     * @return The job title.
+     */
+    const std::string& job_title() const;
+
+    /**
+     * @brief Gets the employment date of the row.
+     *
+     * @return The employment date.
+     */
+    const ModelDate& employment_date() const;
+
+    /**
+     * @brief Gets the hash value of the row.
+     *
+     * @return The hash value.
+     */
+    std::uint32_t get_hash() const;
+
+    /**
+     * @brief Gets the index of the row in the table.
+     *
+     * @return The row index.
+     */
+    std::size_t get_index() const;
+
+    /**
+     * @brief Gets the value of a specific string field of the row.
+     *
+     * @param field The field identifier (same numbering as in Model).
+     *
+     * @return The value of the field.
+     */
+    std::string_view get_field(std::uint8_t field) const;
+
+    /**
+     * @brief Materializes the row as a Model object.
+     *
+     * @return The Model holding a copy of the row.
+     */
+    Model to_model() const;
+
+    /**
+     * @brief Implicit conversion to Model, so rows can be passed wherever Model is expected.
+     */
+    operator Model() const;
+
+    /**
+     * @brief Overloading the << operator for ModelRow class.
+     *
+     * @param stream The output stream.
+     * @param row The row to be output.
+     *
+     * @return The output stream after printing the row.
+     */
+    friend std::ostream& operator<< (std::ostream& stream, const ModelRow& row);
+
+private:
+    const ModelTable*   _table;
+    std::size_t         _index;
+};
+
+/**
+ * @class ModelTable
+ * @brief Columnar container for employee models.
+ *
+ * Every field of the Model is stored in its own contiguous column, so algorithms that only
+ * need one field (sorting or searching by department, for example) do not drag the other
+ * fields through the cache.
+ *
+ * Columns are std::pmr containers. A table may share ownership of the memory resource
+ * its columns are allocated from, so tables produced by ModelBatch keep their arena
+ * alive for exactly as long as they are used.
+ */
+class ModelTable
+{
+public:
+    /**
+     * @brief Constructor for the ModelTable class.
+     */
+    ModelTable();
+
+    /**
+     * @brief Constructor for the ModelTable class.
+     *
+     * @param model_vector The vector of models to copy into the table.
+     */
+    explicit ModelTable(const std::vector<Model>& model_vector);
+
+    /**
+     * @brief Constructor for the ModelTable class.
+     *
+     * @param resource The memory resource every column is allocated from, the table shares its ownership.
+     */
+    explicit ModelTable(std::shared_ptr<std::pmr::memory_resource> resource);
+
+    /**
+     * @brief Copy constructor for the ModelTable class, the copy uses the default memory resource.
+     *
+     * @param other The other table to be copied.
+     */
+    ModelTable(const ModelTable& other);
+
+    /**
+     * @brief Move constructor for the ModelTable class, the columns and their resource are taken over.
+     *
+     * @param other The other table to be moved from.
+     */
+    ModelTable(ModelTable&& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment operator for the ModelTable class.
+     *
+     * The table keeps its own memory resource, the rows are copied into it.
+     *
+     * @param other The other table to be copied.
+     *
+     * @return Reference to this table.
+     */
+    ModelTable& operator= (const ModelTable& other);
+
+    /**
+     * @brief Move assignment operator for the ModelTable class.
+     *
+     * The table keeps its own memory resource. Columns are taken over when both tables
+     * use the same resource and copied into this table's resource otherwise.
+     *
+     * @param other The other table to be moved from.
+     *
+     * @return Reference to this table.
+     */
+    ModelTable& operator= (ModelTable&& other);
+
+    /**
+     * @brief Destructor for the ModelTable class.
+     */
+    ~ModelTable();
+
+    /**
+     * @brief Reserves storage in every column.
+     *
+     * @param capacity The number of rows to reserve.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Appends a model to the end of the table.
+     *
+     * @param model The model to append.
+     */
+    void push_back(const Model& model);
+
+    /**
+     * @brief Removes all rows from the table.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of rows in the table.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Checks whether the table is empty.
+     *
+     * @return True if the table has no rows.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets a view of the row at the given index.
+     *
+     * @param index The row index.
+     *
+     * @return The row view.
+     */
+    ModelRow operator[] (std::size_t index) const;
+
+    /**
+     * @brief Gets a view of the row at the given index with bounds checking.
+     *
+     * @param index The row index.
+     *
+     * @return The row view.
+     */
+    ModelRow at(std::size_t index) const;
+
+    /**
+     * @brief Converts the table back to a vector of models.
+     *
+     * @return The vector of models.
+     */
+    std::vector<Model> to_vector() const;
+
+    /**
+     * @brief Gets the full name column.
+     *
+     * @return The column.
+     */
+    const std::pmr::vector<std::pmr::string>& name_column() const;
+
+    /**
+     * @brief Gets the dictionary code column for the given field.
+     *
+     * @param field The field identifier (1 - department, 2 - job title).
+     *
+     * @return The column of ModelDictionary codes.
+     */
+    const std::pmr::vector<std::uint16_t>& code_column(std::uint8_t field) const;
+
+    /**
+     * @brief Builds the column of order-preserving ranks for a dictionary encoded field.
+     *
+     * Sorting the table by the returned ranks is equivalent to sorting it by the strings.
+     *
+     * @param field The field identifier (1 - department, 2 - job title).
+     *
+     * @return The column of ModelDictionary ranks.
+     */
+    std::vector<std::uint16_t> rank_column(std::uint8_t field) const;
+
+    /**
+     * @brief Gets the column of comparison keys of a field selected at compile time.
+     *
+     * Keys compare exactly like Model::get_key<F>() does: names and dates are returned
+     * as stored, department and job title as dictionary ranks.
+     *
+     * @tparam F The field tag.
+     *
+     * @return The key column.
+     */
+    template<typename F>
+        decltype(auto) key_column() const;
+
+    /**
+     * @brief Gets the employment date column.
+     *
+     * @return The column.
+     */
+    const std::pmr::vector<ModelDate>& date_column() const;
+
+    /**
+     * @brief Gets the hash column.
+     *
+     * @return The column.
+     */
+    const std::pmr::vector<std::uint32_t>& hash_column() const;
+
+    /**
+     * @brief Gets the hash column for modification.
+     *
+     * @return The column.
+     */
+    std::pmr::vector<std::uint32_t>& hash_column();
+
+    /**
+     * @brief Reorders every column of the table.
+     *
+     * After the call row `index` of the table holds what was previously row `order[index]`.
+     *
+     * @param order The permutation to apply, must have exactly size() entries.
+     */
+    void permute(const std::vector<std::uint32_t>& order);
+
+    /**
+     * @brief Prints the rows of the table.
+     *
+     * @param model_table The table to print.
+     */
+    static void print_table(const ModelTable& model_table);
+
+private:
+    friend class ModelBatch;
+
+    template<typename T>
+        static void permute_column(std::pmr::vector<T>& column, const std::vector<std::uint32_t>& order);
+
+    std::shared_ptr<std::pmr::memory_resource>  _resource;  ///< Keeps the column memory alive, may be empty.
+
+    std::pmr::vector<std::pmr::string>          _full_name;
+    std::pmr::vector<std::uint16_t>             _department;
+    std::pmr::vector<std::uint16_t>             _job_title;
+    std::pmr::vector<ModelDate>                 _employment_date;
+
+    //HASHING
+    std::pmr::vector<std::uint32_t>             _model_hash;
+};
+
+template<typename F>
+decltype(auto) ModelTable::key_column() const
+{
+    if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+    {
+        return this->rank_column(F::index);
+    }
+    else if constexpr (std::is_same_v<F, Field::Date>)
+    {
+        return this->date_column();
+    }
+    else
+    {
+        return this->name_column();
+    }
+}
+
+template<typename T>
+void ModelTable::permute_column(std::pmr::vector<T>& column, const std::vector<std::uint32_t>& order)
+{
+    std::pmr::vector<T> permuted(column.get_allocator());
+    permuted.reserve(column.size());
+
+    for (std::size_t index = 0; index < order.size(); ++index)
+    {
+        permuted.push_back(std::move(column[order[index]]));
+    }
+
+    column.swap(permuted);
+}
+
+template<typename Hasher>
+std::vector<std::list<std::uint32_t>> Hashing::hash_model(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field)
+{
+    Hashing::hash_rows(model_table, hash_function, field);
+
+    const std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    std::vector<std::list<std::uint32_t>> table{model_table.size()};
+
+    for (std::size_t index = 0; index < hash_column.size(); ++index)
+    {
+        table[hash_column[index] % table.size()].push_back(index);
+    }
+    return table;
+}
+
+template<typename Hasher>
+void Hashing::hash_rows(ModelTable& model_table, Hasher&& hash_function, std::uint8_t field)
+{
+    std::pmr::vector<std::uint32_t>& hash_column = model_table.hash_column();
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        using F = decltype(tag);
+
+        if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+        {
+            const std::pmr::vector<std::uint16_t>& key_column = model_table.code_column(F::index);
+            const ModelDictionary& dictionary = ModelDictionary::field_dictionary(F::index);
+
+            std::vector<std::uint32_t> code_hashes(dictionary.size());
+
+            for (std::size_t code = 0; code < code_hashes.size(); ++code)
+            {
+                code_hashes[code] = static_cast<std::uint32_t>(hash_function(std::string_view(dictionary.decode(static_cast<std::uint16_t>(code)))));
+            }
+
+            for (std::size_t index = 0; index < key_column.size(); ++index)
+            {
+                hash_column[index] = code_hashes[key_column[index]];
+            }
+        }
+        else if constexpr (std::is_same_v<F, Field::Date>)
+        {
+            throw std::invalid_argument("field should be a string field");
+        }
+        else
+        {
+            const std::pmr::vector<std::pmr::string>& key_column = model_table.key_column<F>();
+
+            for (std::size_t index = 0; index < key_column.size(); ++index)
+            {
+                hash_column[index] = static_cast<std::uint32_t>(hash_function(std::string_view(key_column[index])));
+            }
+        }
+    });
+}
+
+#endif // MODEL_TABLE_HPP
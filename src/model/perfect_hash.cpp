@@ -0,0 +1,214 @@
+/**
+ * @file       <perfect_hash.cpp>
+ * @brief      This source file holds implementation of PerfectHash class.
+ *
+ *             This calss implements minimal perfect hashing of static string sets.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "perfect_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+    std::uint64_t mix(std::uint64_t value)
+    {
+        value ^= value >> 31;
+        value *= 0xBF58476D1CE4E5B9ull;
+        value ^= value >> 29;
+        value *= 0x94D049BB133111EBull;
+        value ^= value >> 32;
+        return value;
+    }
+
+    /**
+     * @brief Maps a 32-bit value onto [0, range) with a multiplication instead of a modulo.
+     */
+    std::size_t reduce(std::uint32_t value, std::size_t range)
+    {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(value) * range) >> 32);
+    }
+}
+
+PerfectHash::PerfectHash()
+{
+    this->_seed = 0;
+    this->_size = 0;
+}
+
+PerfectHash::~PerfectHash()
+{
+    return;
+}
+
+void PerfectHash::build(const std::vector<std::string_view>& keys)
+{
+    this->_size = keys.size();
+    this->_pilots.assign(std::max<std::size_t>(1, (keys.size() + PerfectHash::bucket_keys - 1) / PerfectHash::bucket_keys), 0);
+
+    if (keys.empty())
+    {
+        return;
+    }
+
+    std::vector<std::uint64_t> hashes(keys.size());
+    std::vector<std::vector<std::uint32_t>> buckets(this->_pilots.size());
+    std::vector<std::size_t> order(buckets.size());
+    std::vector<bool> taken(keys.size());
+    std::vector<std::size_t> positions;
+
+    for (std::uint32_t attempt = 0; attempt < PerfectHash::seed_attempts; ++attempt)
+    {
+        this->_seed = mix(0x9E3779B97F4A7C15ull * (attempt + 1));
+
+        for (std::vector<std::uint32_t>& bucket : buckets)
+        {
+            bucket.clear();
+        }
+
+        for (std::size_t key = 0; key < keys.size(); ++key)
+        {
+            hashes[key] = PerfectHash::key_hash(keys[key], this->_seed);
+            buckets[this->bucket(hashes[key])].push_back(static_cast<std::uint32_t>(key));
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t l_bucket, std::size_t r_bucket)
+        {
+            return buckets[l_bucket].size() > buckets[r_bucket].size();
+        });
+
+        std::fill(taken.begin(), taken.end(), false);
+
+        bool placed_all = true;
+
+        for (std::size_t bucket : order)
+        {
+            bool placed = false;
+
+            for (std::uint32_t pilot = 0; pilot <= 0xFFFF && !placed; ++pilot)
+            {
+                positions.clear();
+
+                for (std::uint32_t key : buckets[bucket])
+                {
+                    std::size_t position = this->position(hashes[key], static_cast<std::uint16_t>(pilot));
+
+                    if (taken[position] || std::find(positions.begin(), positions.end(), position) != positions.end())
+                    {
+                        break;
+                    }
+                    positions.push_back(position);
+                }
+
+                if (positions.size() == buckets[bucket].size())
+                {
+                    for (std::size_t position : positions)
+                    {
+                        taken[position] = true;
+                    }
+
+                    this->_pilots[bucket] = static_cast<std::uint16_t>(pilot);
+                    placed = true;
+                }
+            }
+
+            if (!placed)
+            {
+                // Keys with equal 64-bit hashes can not be separated by any pilot.
+                for (std::size_t l_key = 0; l_key + 1 < buckets[bucket].size(); ++l_key)
+                {
+                    for (std::size_t r_key = l_key + 1; r_key < buckets[bucket].size(); ++r_key)
+                    {
+                        if (keys[buckets[bucket][l_key]] == keys[buckets[bucket][r_key]])
+                        {
+                            throw std::invalid_argument("PerfectHash keys should be distinct");
+                        }
+                    }
+                }
+
+                placed_all = false;
+                break;
+            }
+        }
+
+        if (placed_all)
+        {
+            return;
+        }
+    }
+
+    throw std::runtime_error("PerfectHash could not find a function for the given keys");
+}
+
+std::size_t PerfectHash::index(std::string_view key) const
+{
+    if (this->_size == 0)
+    {
+        return 0;
+    }
+
+    std::uint64_t hash = PerfectHash::key_hash(key, this->_seed);
+
+    return this->position(hash, this->_pilots[this->bucket(hash)]);
+}
+
+std::size_t PerfectHash::size() const
+{
+    return this->_size;
+}
+
+std::size_t PerfectHash::bytes() const
+{
+    return this->_pilots.size() * sizeof(std::uint16_t);
+}
+
+/**
+ * Reads the key eight bytes at a time, the dictionary keys are a few dozen bytes long.
+ */
+std::uint64_t PerfectHash::key_hash(std::string_view key, std::uint64_t seed)
+{
+    std::uint64_t hash = seed ^ (key.size() * 0x9E3779B97F4A7C15ull);
+    std::uint64_t word = 0;
+    std::size_t offset = 0;
+
+    for (; offset + sizeof(word) <= key.size(); offset += sizeof(word))
+    {
+        std::memcpy(&word, key.data() + offset, sizeof(word));
+        hash = mix(hash ^ word);
+    }
+
+    if (offset < key.size())
+    {
+        word = 0;
+        std::memcpy(&word, key.data() + offset, key.size() - offset);
+        hash = mix(hash ^ word);
+    }
+
+    return hash;
+}
+
+std::size_t PerfectHash::bucket(std::uint64_t hash) const
+{
+    return reduce(static_cast<std::uint32_t>(hash), this->_pilots.size());
+}
+
+std::size_t PerfectHash::position(std::uint64_t hash, std::uint16_t pilot) const
+{
+    return reduce(static_cast<std::uint32_t>(mix(hash ^ (0x9E3779B97F4A7C15ull * (pilot + 1ull))) >> 32), this->_size);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file       <perfect_hash.hpp>
+ * @brief      This header file holds implementation of PerfectHash class.
+ *
+ *             This calss implements minimal perfect hashing of static string sets.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef PERFECT_HASH_HPP
+#define PERFECT_HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class PerfectHash
+ * @brief Minimal perfect hash function over a fixed set of strings (CHD-style).
+ *
+ * The keys are split into buckets of about four by one hash, and every bucket, largest
+ * first, gets the smallest 16-bit pilot that sends all of its keys to free positions in
+ * [0, size). A lookup hashes the key once, reads the pilot of its bucket and computes
+ * the position, there are no collisions to resolve and no second probe. The function
+ * itself takes two bytes per bucket, a few hundred bytes for the dictionaries of Model.
+ *
+ * Keys outside of the set map to some position as well, so callers verify the key
+ * stored at the returned position.
+ */
+class PerfectHash
+{
+public:
+    /**
+     * @brief Constructor for the PerfectHash class.
+     */
+    PerfectHash();
+
+    /**
+     * @brief Destructor for the PerfectHash class.
+     */
+    ~PerfectHash();
+
+    /**
+     * @brief Builds the function for a set of keys.
+     *
+     * @param keys The keys, every key must be distinct.
+     *
+     * @throws std::invalid_argument If a key is repeated.
+     * @throws std::runtime_error If no function is found, which does not happen in practice.
+     */
+    void build(const std::vector<std::string_view>& keys);
+
+    /**
+     * @brief Gets the position of a key.
+     *
+     * @param key The key.
+     *
+     * @return A position in [0, size()), distinct for every key of the set.
+     */
+    std::size_t index(std::string_view key) const;
+
+    /**
+     * @brief Gets the number of keys in the set.
+     *
+     * @return The number of keys.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the memory taken by the pilot table.
+     *
+     * @return The number of bytes.
+     */
+    std::size_t bytes() const;
+
+private:
+    static constexpr std::size_t bucket_keys = 4;          ///< Average number of keys per bucket.
+    static constexpr std::uint32_t seed_attempts = 16;     ///< Seeds tried before the build gives up.
+
+    static std::uint64_t key_hash(std::string_view key, std::uint64_t seed);
+
+    std::size_t bucket(std::uint64_t hash) const;
+    std::size_t position(std::uint64_t hash, std::uint16_t pilot) const;
+
+    std::vector<std::uint16_t>  _pilots;    ///< Pilot of every bucket.
+    std::uint64_t               _seed;
+    std::size_t                 _size;
+};
+
+#endif // PERFECT_HASH_HPP
@@ -0,0 +1,20 @@
+/**
+ * @file       <record.cpp>
+ * @brief      This source file holds implementation of RecordSchema, Records and RecordTable classes.
+ *
+ *             This calss implements compile-time record schemas shared by sorting, searching and hashing.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "record.hpp"
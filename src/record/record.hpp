@@ -0,0 +1,528 @@
+/**
+ * @file       <record.hpp>
+ * @brief      This header file holds implementation of RecordSchema, Records and RecordTable classes.
+ *
+ *             This calss implements compile-time record schemas shared by sorting, searching and hashing.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef RECORD_HPP
+#define RECORD_HPP
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/json.hpp>
+
+/**
+ * @struct RecordName
+ * @brief Compile-time string used to name record fields.
+ *
+ * @tparam N The length of the name including the terminating zero.
+ */
+template<std::size_t N>
+struct RecordName
+{
+    constexpr RecordName(const char (&value)[N])
+    {
+        std::copy_n(value, N, this->value);
+    }
+
+    constexpr std::string_view view() const
+    {
+        return std::string_view(this->value, N - 1);
+    }
+
+    char value[N];
+};
+
+/**
+ * @struct RecordField
+ * @brief Describes one field of a record.
+ *
+ * A field is anything that provides a static `name`, a static `get(record)` returning the
+ * value of the field and a static `key(record)` returning something three-way comparable
+ * and hashable that orders records the same way the values do. RecordField builds such a
+ * description from a data member pointer or from a (member) function.
+ *
+ * @tparam Name The name of the field.
+ * @tparam Accessor Pointer to the data member or the function returning the value.
+ * @tparam KeyAccessor Pointer to the data member or the function returning the comparison key.
+ */
+template<RecordName Name, auto Accessor, auto KeyAccessor = Accessor>
+struct RecordField
+{
+    static constexpr std::string_view name = Name.view();
+
+    template<typename Record>
+        static decltype(auto) get(const Record& record)
+        {
+            return std::invoke(Accessor, record);
+        }
+
+    template<typename Record>
+        static decltype(auto) key(const Record& record)
+        {
+            return std::invoke(KeyAccessor, record);
+        }
+};
+
+/**
+ * @brief Type of the comparison key of a field.
+ */
+template<typename F, typename Record>
+    using RecordKey = std::remove_cvref_t<decltype(F::key(std::declval<const Record&>()))>;
+
+/**
+ * @brief Type of the value of a field.
+ */
+template<typename F, typename Record>
+    using RecordValue = std::remove_cvref_t<decltype(F::get(std::declval<const Record&>()))>;
+
+/**
+ * @struct RecordSchema
+ * @brief Ordered list of the fields of a record.
+ *
+ * A record type declares its schema as a nested `schema` alias, or through a RecordTraits
+ * specialization when the type can not be changed.
+ *
+ * @tparam Fields The field descriptions, see RecordField.
+ */
+template<typename... Fields>
+struct RecordSchema
+{
+    static_assert(sizeof...(Fields) > 0, "schema should have at least one field");
+
+    static constexpr std::size_t size = sizeof...(Fields);
+
+    static constexpr std::array<std::string_view, sizeof...(Fields)> names{Fields::name...};
+
+    template<std::size_t Index>
+        using field = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+    /**
+     * @brief Gets the position of a field by its name.
+     *
+     * @param name The name of the field.
+     *
+     * @return The position of the field, or size if there is no such field.
+     */
+    static constexpr std::size_t index_of(std::string_view name)
+    {
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            if (names[index] == name)
+            {
+                return index;
+            }
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Calls a function with every field description in schema order.
+     *
+     * @tparam Function Callable accepting any field description.
+     * @param function The function to call.
+     */
+    template<typename Function>
+        static void for_each(Function&& function)
+        {
+            (function(Fields{}), ...);
+        }
+
+    /**
+     * @brief Converts a runtime field position into a field description and calls a function with it.
+     *
+     * @tparam Function Callable accepting any field description.
+     * @param index The position of the field.
+     * @param function The function to call.
+     *
+     * @return Whatever the function returns.
+     *
+     * @throws std::out_of_range If the position is not less than size.
+     */
+    template<std::size_t Index = 0, typename Function>
+        static decltype(auto) dispatch(std::size_t index, Function&& function)
+        {
+            if constexpr (Index + 1 < size)
+            {
+                if (index == Index)
+                {
+                    return function(field<Index>{});
+                }
+
+                return RecordSchema::dispatch<Index + 1>(index, std::forward<Function>(function));
+            }
+            else
+            {
+                if (index != Index)
+                {
+                    throw std::out_of_range("schema has no field with this index");
+                }
+
+                return function(field<Index>{});
+            }
+        }
+};
+
+/**
+ * @struct RecordTraits
+ * @brief Customization point giving the schema of a record type.
+ *
+ * @tparam Record The record type.
+ */
+template<typename Record>
+struct RecordTraits
+{
+    using schema = typename Record::schema;
+};
+
+template<typename Record>
+    using RecordSchemaOf = typename RecordTraits<Record>::schema;
+
+/**
+ * @class Records
+ * @brief Operations generated from the schema of any record type.
+ *
+ * Every operation is resolved at compile time from the field descriptions, so a record
+ * compared or hashed through Records costs exactly the accesses of the selected fields.
+ */
+class Records
+{
+public:
+    /**
+     * @brief Lexicographically three-way compares records by the keys of the given fields.
+     *
+     * @tparam F The first field.
+     * @tparam Fs The tie-breaking fields.
+     * @tparam Record The record type.
+     * @param l_record The left record.
+     * @param r_record The right record.
+     *
+     * @return The ordering of the left record relative to the right one.
+     */
+    template<typename F, typename... Fs, typename Record>
+        static auto compare(const Record& l_record, const Record& r_record);
+
+    /**
+     * @brief Lexicographically three-way compares records by every field of their schema.
+     *
+     * @tparam Record The record type.
+     * @param l_record The left record.
+     * @param r_record The right record.
+     *
+     * @return The ordering of the left record relative to the right one.
+     */
+    template<typename Record>
+        static auto compare_all(const Record& l_record, const Record& r_record);
+
+    /**
+     * @brief Converts a search value into the comparison key of a field.
+     *
+     * Record types may provide a static `make_key<F>(value)` of their own, otherwise the
+     * value is converted to the key type directly.
+     *
+     * @tparam F The field.
+     * @tparam Record The record type.
+     * @tparam T The type of the value.
+     * @param value The value to convert.
+     *
+     * @return The key, or an empty optional if no record can hold this value.
+     *
+     * @throws std::invalid_argument If the value can not be converted to the key type.
+     */
+    template<typename F, typename Record, typename T>
+        static auto make_key(const T& value);
+
+    /**
+     * @brief Hashes the keys of the given fields of a record.
+     *
+     * @tparam Fs The fields to hash, every schema field if empty.
+     * @tparam Record The record type.
+     * @param record The record.
+     *
+     * @return The hash value.
+     */
+    template<typename... Fs, typename Record>
+        static std::size_t hash(const Record& record);
+
+    /**
+     * @brief Serializes every field of a record into a JSON object keyed by field names.
+     *
+     * Arithmetic values are stored as numbers, string-like values as strings and anything
+     * else through its stream output operator.
+     *
+     * @tparam Record The record type.
+     * @param record The record.
+     *
+     * @return The JSON object.
+     */
+    template<typename Record>
+        static boost::json::object to_json(const Record& record);
+
+private:
+    template<typename Schema, typename Record, std::size_t... Index>
+        static auto compare_schema(const Record& l_record, const Record& r_record, std::index_sequence<Index...>);
+    template<typename Schema, typename Record, std::size_t... Index>
+        static std::size_t hash_schema(const Record& record, std::index_sequence<Index...>);
+
+    template<typename T>
+        static boost::json::value to_json_value(const T& value);
+};
+
+/**
+ * @class RecordTable
+ * @brief Columnar (struct-of-arrays) storage generated from the schema of a record type.
+ *
+ * Column `Index` holds the values of schema field `Index`.
+ *
+ * @tparam Record The record type.
+ */
+template<typename Record>
+class RecordTable
+{
+public:
+    using schema = RecordSchemaOf<Record>;
+
+    /**
+     * @brief Reserves storage in every column.
+     *
+     * @param capacity The number of rows to reserve.
+     */
+    void reserve(std::size_t capacity)
+    {
+        std::apply([&](auto&... column) { (column.reserve(capacity), ...); }, this->_columns);
+    }
+
+    /**
+     * @brief Appends the field values of a record.
+     *
+     * @param record The record to append.
+     */
+    void push_back(const Record& record)
+    {
+        this->push_back_fields(record, std::make_index_sequence<schema::size>{});
+    }
+
+    /**
+     * @brief Gets the number of rows in the table.
+     *
+     * @return The number of rows.
+     */
+    std::size_t size() const
+    {
+        return std::get<0>(this->_columns).size();
+    }
+
+    /**
+     * @brief Gets the column of a field.
+     *
+     * @tparam Index The position of the field in the schema.
+     *
+     * @return The column.
+     */
+    template<std::size_t Index>
+        const auto& column() const
+        {
+            return std::get<Index>(this->_columns);
+        }
+
+    /**
+     * @brief Reorders every column of the table.
+     *
+     * After the call row `index` of the table holds what was previously row `order[index]`.
+     *
+     * @param order The permutation to apply, must have exactly size() entries.
+     */
+    void permute(const std::vector<std::uint32_t>& order)
+    {
+        if (order.size() != this->size())
+        {
+            throw std::invalid_argument("order should have exactly one entry per row");
+        }
+
+        std::apply([&](auto&... column) { (RecordTable::permute_column(column, order), ...); }, this->_columns);
+    }
+
+private:
+    template<typename Schema>
+        struct column_tuple;
+
+    template<typename... Fields>
+        struct column_tuple<RecordSchema<Fields...>>
+        {
+            using type = std::tuple<std::vector<RecordValue<Fields, Record>>...>;
+        };
+
+    template<std::size_t... Index>
+        void push_back_fields(const Record& record, std::index_sequence<Index...>)
+        {
+            (std::get<Index>(this->_columns).emplace_back(schema::template field<Index>::get(record)), ...);
+        }
+
+    template<typename T>
+        static void permute_column(std::vector<T>& column, const std::vector<std::uint32_t>& order)
+        {
+            std::vector<T> permuted;
+            permuted.reserve(column.size());
+
+            for (std::size_t index = 0; index < order.size(); ++index)
+            {
+                permuted.push_back(std::move(column[order[index]]));
+            }
+
+            column.swap(permuted);
+        }
+
+    typename column_tuple<schema>::type _columns;
+};
+
+template<typename F, typename... Fs, typename Record>
+auto Records::compare(const Record& l_record, const Record& r_record)
+{
+    using ordering = std::common_comparison_category_t<std::compare_three_way_result_t<RecordKey<F, Record>>, std::compare_three_way_result_t<RecordKey<Fs, Record>>...>;
+
+    ordering result = F::key(l_record) <=> F::key(r_record);
+
+    if constexpr (sizeof...(Fs) > 0)
+    {
+        if (result == 0)
+        {
+            return static_cast<ordering>(Records::compare<Fs...>(l_record, r_record));
+        }
+    }
+
+    return result;
+}
+
+template<typename Record>
+auto Records::compare_all(const Record& l_record, const Record& r_record)
+{
+    return Records::compare_schema<RecordSchemaOf<Record>>(l_record, r_record, std::make_index_sequence<RecordSchemaOf<Record>::size>{});
+}
+
+template<typename Schema, typename Record, std::size_t... Index>
+auto Records::compare_schema(const Record& l_record, const Record& r_record, std::index_sequence<Index...>)
+{
+    return Records::compare<typename Schema::template field<Index>...>(l_record, r_record);
+}
+
+template<typename F, typename Record, typename T>
+auto Records::make_key(const T& value)
+{
+    if constexpr (requires { Record::template make_key<F>(value); })
+    {
+        return Record::template make_key<F>(value);
+    }
+    else
+    {
+        using key_type = RecordKey<F, Record>;
+
+        std::optional<key_type> key;
+
+        if constexpr (std::is_convertible_v<const T&, key_type>)
+        {
+            key = static_cast<key_type>(value);
+        }
+        else
+        {
+            throw std::invalid_argument("value should be convertible to the key of the field");
+        }
+
+        return key;
+    }
+}
+
+template<typename... Fs, typename Record>
+std::size_t Records::hash(const Record& record)
+{
+    if constexpr (sizeof...(Fs) == 0)
+    {
+        return Records::hash_schema<RecordSchemaOf<Record>>(record, std::make_index_sequence<RecordSchemaOf<Record>::size>{});
+    }
+    else
+    {
+        std::size_t seed = 0;
+
+        // Same mixing step as boost::hash_combine.
+        ((seed ^= std::hash<RecordKey<Fs, Record>>{}(Fs::key(record)) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+
+        return seed;
+    }
+}
+
+template<typename Schema, typename Record, std::size_t... Index>
+std::size_t Records::hash_schema(const Record& record, std::index_sequence<Index...>)
+{
+    return Records::hash<typename Schema::template field<Index>...>(record);
+}
+
+template<typename Record>
+boost::json::object Records::to_json(const Record& record)
+{
+    boost::json::object object;
+
+    RecordSchemaOf<Record>::for_each([&](auto field)
+    {
+        object.emplace(decltype(field)::name, Records::to_json_value(decltype(field)::get(record)));
+    });
+
+    return object;
+}
+
+template<typename T>
+boost::json::value Records::to_json_value(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return boost::json::value(value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        return boost::json::value(static_cast<std::int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return boost::json::value(static_cast<std::uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return boost::json::value(static_cast<double>(value));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        return boost::json::value(std::string_view(value));
+    }
+    else
+    {
+        std::ostringstream stream;
+        stream << value;
+
+        return boost::json::value(std::string_view(stream.str()));
+    }
+}
+
+#endif // RECORD_HPP
@@ -24,6 +24,14 @@
 #include "../model/model.hpp"
 #endif // MODEL_HPP
 
+#ifndef MODEL_TABLE_HPP
+#include "../model/model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#ifndef MODEL_KEY_HPP
+#include "../model/model_key.hpp"
+#endif // MODEL_KEY_HPP
+
 #include <iostream>
 
 /**
@@ -32,6 +40,8 @@
  * @brief A class that provides static searching methods for sorting a vector of Model objects based on a specific field.
  * 
  * @note Currently provides implementations for binary search.
+ * 
+ * @note Every probe performs a single three-way comparison of precomputed keys.
  */
 class Search
 {
@@ -61,32 +71,129 @@ public:
      */
     template<typename T>
         static int straight_search(std::vector<Model>& model_vector, T search_value, std::uint8_t field); 
+
+    /**
+     * @brief Performs binary search on a vector of Model objects based on a field selected at compile time.
+     *
+     * The search value is converted into a comparison key once, every probe then
+     * compares two keys without any runtime switch or type check. Works for any record
+     * type with a RecordSchema, F being one of its fields.
+     *
+     * @tparam F The field tag.
+     * @tparam T The type of the search value.
+     * @tparam Record The record type, deduced from the vector.
+     * @param model_vector The vector of Model objects to search in, sorted by the field.
+     * @param search_value The value to search for.
+     * 
+     * @return The index of the found element, or -1 if not found.
+     */
+    template<typename F, typename T, typename Record>
+        static int binary_search(const std::vector<Record>& model_vector, const T& search_value);
+
+    /**
+     * @brief Performs straight search on a vector of Model objects based on a field selected at compile time.
+     *
+     * @tparam F The field tag.
+     * @tparam T The type of the search value.
+     * @tparam Record The record type, deduced from the vector.
+     * @param model_vector The vector of Model objects to search in.
+     * @param search_value The value to search for.
+     * 
+     * @return The index of the found element, or -1 if not found.
+     */
+    template<typename F, typename T, typename Record>
+        static int straight_search(const std::vector<Record>& model_vector, const T& search_value);
+
+    /**
+     * @brief Performs binary search on the normalized keys of a sorted vector of Model objects.
+     *
+     * Probes compare two 16-byte keys, the models are only touched on key ties when the
+     * encoder is not exact.
+     *
+     * @tparam T The type of the search value.
+     * @param model_vector The vector of Model objects to search in.
+     * @param keys The sorted keys returned by the ModelKeyEncoder overloads of Sorting.
+     * @param encoder The single-field encoder the keys were built with.
+     * @param search_value The value to search for.
+     * 
+     * @return The index of the found element, or -1 if not found.
+     */
+    template<typename T>
+        static int binary_search(const std::vector<Model>& model_vector, const std::vector<ModelKey>& keys, const ModelKeyEncoder& encoder, const T& search_value);
+
+    /**
+     * @brief Performs binary search on the key column of a ModelTable.
+     *
+     * @tparam T The type of the search value.
+     * @param model_table The table to search in, sorted by the given field.
+     * @param search_value The value to search for.
+     * @param field The field on which to perform the search.
+     * 
+     * @return The index of the found row, or -1 if not found.
+     */
+    template<typename T>
+        static int binary_search(const ModelTable& model_table, T search_value, std::uint8_t field);
+
+    /**
+     * @brief Performs straight search on the key column of a ModelTable.
+     *
+     * @tparam T The type of the search value.
+     * @param model_table The table to search in.
+     * @param search_value The value to search for.
+     * @param field The field on which to perform the search.
+     * 
+     * @return The index of the found row, or -1 if not found.
+     */
+    template<typename T>
+        static int straight_search(const ModelTable& model_table, T search_value, std::uint8_t field);
 };
 
 
 template<typename T>
 int Search::binary_search(std::vector<Model>& model_vector, T search_value, std::uint8_t field) 
 {
-    int dummy = 0;
+    return Field::dispatch(field, [&](auto tag)
+    {
+        return Search::binary_search<decltype(tag)>(model_vector, search_value);
+    });
+}
+
+template<typename T>
+int Search::straight_search(std::vector<Model>& model_vector, T search_value, std::uint8_t field) 
+{
+    return Field::dispatch(field, [&](auto tag)
+    {
+        return Search::straight_search<decltype(tag)>(model_vector, search_value);
+    });
+}
+
+template<typename F, typename T, typename Record>
+int Search::binary_search(const std::vector<Record>& model_vector, const T& search_value)
+{
+    auto search_key = Records::make_key<F, Record>(search_value);
+
+    if (!search_key.has_value())
+    {
+        return -1;
+    }
+
     int left = 0;
     int right = model_vector.size() - 1;
-    uint8_t offset = field * 2;
 
     while (left <= right) 
     {
         int mid = (left + right) / 2;
+        auto comp_result = F::key(model_vector[mid]) <=> search_key.value();
 
-        if (((int)model_vector.at(mid).compare_type<T>(field, search_value).get_type_masked(offset) == 0))
+        if (comp_result == 0)
         {
             return mid;
         }
-
-        else if (((int)model_vector.at(mid).compare_type<T>(field, search_value).get_type_masked(offset) == 1))
+        else if (comp_result < 0)
         {
             left = mid + 1;
         }
-
-        else if (((int)model_vector.at(mid).compare_type<T>(field, search_value).get_type_masked(offset) == 2))
+        else
         {
             right = mid - 1; 
         }
@@ -94,14 +201,19 @@ int Search::binary_search(std::vector<Model>& model_vector, T search_value, std:
     return -1;
 }
 
-template<typename T>
-int Search::straight_search(std::vector<Model>& model_vector, T search_value, std::uint8_t field) 
+template<typename F, typename T, typename Record>
+int Search::straight_search(const std::vector<Record>& model_vector, const T& search_value)
 {
-    uint8_t offset = field * 2;
+    auto search_key = Records::make_key<F, Record>(search_value);
+
+    if (!search_key.has_value())
+    {
+        return -1;
+    }
 
     for (std::size_t index = 0; index < model_vector.size(); ++index) 
     {
-        if (((int)model_vector.at(index).compare_type<T>(field, search_value).get_type_masked(offset) == 0))
+        if (F::key(model_vector[index]) == search_key.value())
         {
             return index;
         }
@@ -109,4 +221,181 @@ int Search::straight_search(std::vector<Model>& model_vector, T search_value, st
     return -1;
 }
 
+template<typename T>
+int Search::binary_search(const std::vector<Model>& model_vector, const std::vector<ModelKey>& keys, const ModelKeyEncoder& encoder, const T& search_value)
+{
+    if (encoder.fields().size() != 1)
+    {
+        throw std::invalid_argument("encoder should have exactly one field");
+    }
+
+    std::optional<ModelKey> search_key = encoder.encode_value(search_value);
+
+    if (!search_key.has_value())
+    {
+        return -1;
+    }
+
+    int left = 0;
+    int right = keys.size() - 1;
+
+    while (left <= right) 
+    {
+        int mid = (left + right) / 2;
+        std::strong_ordering comp_result = ModelKey::compare(keys[mid], search_key.value());
+
+        if (comp_result == 0 && !encoder.exact())
+        {
+            comp_result = Field::dispatch(encoder.fields().front(), [&](auto tag)
+            {
+                return model_vector[keys[mid].row].template get_key<decltype(tag)>() <=> Model::make_key<decltype(tag)>(search_value).value();
+            });
+        }
+
+        if (comp_result == 0)
+        {
+            return keys[mid].row;
+        }
+        else if (comp_result < 0)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid - 1; 
+        }
+    }
+    return -1;
+}
+
+/**
+ * Department and job title compare the dictionary codes of the column with the code
+ * of the value through the rank table, so no rank column is built for a search.
+ */
+template<typename T>
+int Search::binary_search(const ModelTable& model_table, T search_value, std::uint8_t field) 
+{
+    return Field::dispatch(field, [&](auto tag)
+    {
+        using F = decltype(tag);
+
+        int left = 0;
+        int right = model_table.size() - 1;
+
+        if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+        {
+            const std::pmr::vector<std::uint16_t>& column = model_table.code_column(F::index);
+            const ModelDictionary& dictionary = ModelDictionary::field_dictionary(F::index);
+            std::optional<std::uint16_t> search_code = dictionary.find(search_value);
+
+            if (!search_code.has_value())
+            {
+                return -1;
+            }
+
+            while (left <= right) 
+            {
+                int mid = (left + right) / 2;
+                int comp_result = dictionary.compare(column[mid], search_code.value());
+
+                if (comp_result == 0)
+                {
+                    return mid;
+                }
+                else if (comp_result < 0)
+                {
+                    left = mid + 1;
+                }
+                else
+                {
+                    right = mid - 1; 
+                }
+            }
+            return -1;
+        }
+        else
+        {
+            const auto& column = model_table.key_column<F>();
+            auto search_key = Model::make_key<F>(search_value);
+
+            if (!search_key.has_value())
+            {
+                return -1;
+            }
+
+            using key_type = typename decltype(search_key)::value_type;
+
+            while (left <= right) 
+            {
+                int mid = (left + right) / 2;
+                auto comp_result = key_type(column[mid]) <=> search_key.value();
+
+                if (comp_result == 0)
+                {
+                    return mid;
+                }
+                else if (comp_result < 0)
+                {
+                    left = mid + 1;
+                }
+                else
+                {
+                    right = mid - 1; 
+                }
+            }
+            return -1;
+        }
+    });
+}
+
+template<typename T>
+int Search::straight_search(const ModelTable& model_table, T search_value, std::uint8_t field) 
+{
+    return Field::dispatch(field, [&](auto tag)
+    {
+        using F = decltype(tag);
+
+        if constexpr (std::is_same_v<F, Field::Department> || std::is_same_v<F, Field::JobTitle>)
+        {
+            const std::pmr::vector<std::uint16_t>& column = model_table.code_column(F::index);
+            std::optional<std::uint16_t> search_code = ModelDictionary::field_dictionary(F::index).find(search_value);
+
+            if (!search_code.has_value())
+            {
+                return -1;
+            }
+
+            for (std::size_t index = 0; index < column.size(); ++index) 
+            {
+                if (column[index] == search_code.value())
+                {
+                    return static_cast<int>(index);
+                }
+            }
+            return -1;
+        }
+        else
+        {
+            const auto& column = model_table.key_column<F>();
+            auto search_key = Model::make_key<F>(search_value);
+
+            if (!search_key.has_value())
+            {
+                return -1;
+            }
+
+            using key_type = typename decltype(search_key)::value_type;
+
+            for (std::size_t index = 0; index < column.size(); ++index) 
+            {
+                if (key_type(column[index]) == search_key.value())
+                {
+                    return static_cast<int>(index);
+                }
+            }
+            return -1;
+        }
+    });
+}
+
 #endif // SEARCH_HPP
\ No newline at end of file
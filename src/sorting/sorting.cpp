@@ -19,13 +19,16 @@
  */
 #include "sorting.hpp"
 
+#include <array>
+#include <string_view>
+#include <type_traits>
+
 
 /**
  * @brief Sorts the given vector of Model objects using bubble sort algorithm.
  * 
- * This function uses bubble sort algorithm to sort the given vector of Model objects
- * based on the field specified by the `field` parameter. The objects are compared
- * using the `compare_type()` method of the Model class.
+ * The field number is converted to a Field tag once, the sort itself compares
+ * the selected field without any runtime switch.
  * 
  * @param model_vector The vector of Model objects to be sorted.
  * @param field The index of the field to be used for sorting the objects.
@@ -33,39 +36,13 @@
  * @return void.
  *
  * @note This function modifies the original vector passed to it.
- * 
- * @note The `compare_type()` method of the Model class must return a Type object.
- * 
- * @note The Type object must have a method `get_type_masked()` that takes an
- *       offset and returns a boolean indicating whether the specified bit is set or not.
- * 
- * @note This function prints the number of iterations taken to sort the vector.
  */
 void Sorting::bubble_sort(std::vector<Model>& model_vector, uint8_t field)
 {
-    bool has_changed;
-
-    uint8_t offset = field * 2;
-
-    std::size_t iteration_counter = 0;
-
-    do
+    Field::dispatch(field, [&](auto tag)
     {
-        has_changed = false;
-
-        for (std::size_t index = 0; index < model_vector.size() - 1; ++index)
-        {
-            if ((bool)(model_vector.at(index).compare_type(model_vector.at(index + 1), field)).get_type_masked(offset))
-            {
-                std::swap(model_vector[index], model_vector[index + 1]);
-                has_changed = true;
-            }
-        }
-        iteration_counter += 1;
-    }   
-    while (has_changed);
-
-    //std::cout << "Sorting took " << iteration_counter << " iterations." << std::endl;
+        Sorting::bubble_sort<decltype(tag)>(model_vector);
+    });
 
     return;
 }
@@ -73,9 +50,9 @@ void Sorting::bubble_sort(std::vector<Model>& model_vector, uint8_t field)
 /**
  * @brief Performs heap sort on a vector of Model objects.
  * 
- * This function sorts a vector of Model objects using the heap sort algorithm. The function uses
- * the make_heap function to create a heap from the input vector, then sorts the heap by repeatedly
- * extracting the maximum element from the heap and placing it at the end of the vector.
+ * This function sorts a vector of Model objects using the heap sort algorithm. The function
+ * builds a heap from the input vector, then sorts the heap by repeatedly extracting the
+ * maximum element from the heap and placing it at the end of the vector.
  * 
  * @param model_vector The vector of Model objects to be sorted.
  * @param field The field of the Model object to sort by.
@@ -84,18 +61,10 @@ void Sorting::bubble_sort(std::vector<Model>& model_vector, uint8_t field)
 */
 void Sorting::heap_sort(std::vector<Model>& model_vector, uint8_t field)
 {
-    uint8_t offset = field * 2;
-
-    for (std::int32_t index = (model_vector.size() / 2) - 1; index >= 0; --index)
-    {
-        Sorting::make_heap(model_vector, index, field);
-    }
-  
-    for (std::int32_t index = model_vector.size() - 1; index >= 0; --index)
+    Field::dispatch(field, [&](auto tag)
     {
-        std::swap(model_vector[0], model_vector[index]);
-        Sorting::make_heap(model_vector, 0, field, index);
-    }    
+        Sorting::heap_sort<decltype(tag)>(model_vector);
+    });
 
     return;
 }
@@ -118,127 +87,734 @@ void Sorting::heap_sort(std::vector<Model>& model_vector, uint8_t field)
  */
 void Sorting::merge_sort(std::vector<Model>& model_vector, uint8_t field, std::size_t left, std::size_t right, bool initial)
 {
-    if (initial)
+    Field::dispatch(field, [&](auto tag)
     {
-        left = 0;
-        right = model_vector.size() - 1;
-    }
+        Sorting::merge_sort<decltype(tag)>(model_vector, left, right, initial);
+    });
 
-    if(left >= right) 
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using pattern-defeating quicksort.
+ * 
+ * Dates, departments and job titles are ordered by integer keys and partitioned
+ * branchlessly, full names take the ordinary partition.
+ * 
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param field The field to be sorted.
+ * 
+ * @return void.
+ */
+void Sorting::fast_sort(std::vector<Model>& model_vector, uint8_t field)
+{
+    Field::dispatch(field, [&](auto tag)
     {
-        return;
+        Sorting::fast_sort<decltype(tag)>(model_vector);
+    });
+
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using MSD radix sort.
+ * 
+ * Row indices are sorted by the bytes of the keys and the models are moved into
+ * place once. Names are sorted by their characters, so a prefix shared by many names
+ * is read once per name instead of once per comparison. Departments and job titles
+ * are sorted by the two bytes of their dictionary rank, dates by the four bytes of
+ * their day number. The sort is stable.
+ * 
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param field The field to be sorted.
+ * 
+ * @return void.
+ */
+void Sorting::radix_sort(std::vector<Model>& model_vector, uint8_t field)
+{
+    std::vector<std::uint32_t> order = Sorting::make_order(model_vector.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        Sorting::radix_sort_order(model_vector.size(), [&](std::size_t row)
+        {
+            return model_vector[row].get_key<decltype(tag)>();
+        }, order);
+    });
+
+    Sorting::apply_order(model_vector, order);
+
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using merge sort on several threads.
+ * 
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param field The field to be sorted.
+ * @param threads The number of threads, 0 for every hardware thread.
+ * 
+ * @return void.
+ */
+void Sorting::parallel_merge_sort(std::vector<Model>& model_vector, uint8_t field, std::size_t threads)
+{
+    Field::dispatch(field, [&](auto tag)
+    {
+        Sorting::parallel_merge_sort<decltype(tag)>(model_vector, threads);
+    });
+
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using merge sort on the threads of a pool.
+ * 
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param field The field to be sorted.
+ * @param pool The pool to sort on.
+ * @param buffer Scratch storage kept by the caller, empty after the sort.
+ * 
+ * @return void.
+ */
+void Sorting::parallel_merge_sort(std::vector<Model>& model_vector, uint8_t field, WorkStealingPool& pool, std::vector<Model>& buffer)
+{
+    Field::dispatch(field, [&](auto tag)
+    {
+        Sorting::parallel_merge_sort<decltype(tag)>(model_vector, pool, buffer);
+    });
+
+    return;
+}
+
+/**
+ * @brief Sorts the rows of the given ModelTable using bubble sort algorithm.
+ * 
+ * Only the key column selected by `field` is read while sorting, the rest of
+ * the columns are reordered once after the permutation is known. Department and
+ * job title are sorted by their dictionary ranks, so no strings are compared.
+ * 
+ * @param model_table The table to be sorted.
+ * @param field The index of the field to be used for sorting the rows.
+ *
+ * @return void.
+ */
+void Sorting::bubble_sort(ModelTable& model_table, uint8_t field)
+{
+    std::vector<std::uint32_t> order = Sorting::make_order(model_table.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        Sorting::bubble_sort_order(model_table.key_column<decltype(tag)>(), order);
+    });
+
+    model_table.permute(order);
+
+    return;
+}
+
+/**
+ * @brief Sorts the rows of the given ModelTable using heap sort algorithm.
+ * 
+ * @param model_table The table to be sorted.
+ * @param field The index of the field to be used for sorting the rows.
+ *
+ * @return void.
+ */
+void Sorting::heap_sort(ModelTable& model_table, uint8_t field)
+{
+    std::vector<std::uint32_t> order = Sorting::make_order(model_table.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        Sorting::heap_sort_order(model_table.key_column<decltype(tag)>(), order);
+    });
+
+    model_table.permute(order);
+
+    return;
+}
+
+/**
+ * @brief Sorts the rows of the given ModelTable using merge sort algorithm.
+ * 
+ * A single scratch buffer of row indices is shared by every merge.
+ * 
+ * @param model_table The table to be sorted.
+ * @param field The index of the field to be used for sorting the rows.
+ *
+ * @return void.
+ */
+void Sorting::merge_sort(ModelTable& model_table, uint8_t field)
+{
+    std::vector<std::uint32_t> order = Sorting::make_order(model_table.size());
+    std::vector<std::uint32_t> buffer(order.size());
+
+    if (order.size() > 1)
+    {
+        Field::dispatch(field, [&](auto tag)
+        {
+            Sorting::merge_sort_order(model_table.key_column<decltype(tag)>(), order, buffer, 0, order.size() - 1);
+        });
     }
 
-    std::size_t middle = left + (right - left) / 2;
+    model_table.permute(order);
+
+    return;
+}
 
-    Sorting::merge_sort(model_vector, field, left, middle, false);
-    Sorting::merge_sort(model_vector, field, middle + 1, right, false);
-    Sorting::make_merge(model_vector, field, left, right, middle);
+/**
+ * @brief Sorts the rows of the given ModelTable using MSD radix sort.
+ * 
+ * @param model_table The table to be sorted.
+ * @param field The index of the field to be used for sorting the rows.
+ *
+ * @return void.
+ */
+void Sorting::radix_sort(ModelTable& model_table, uint8_t field)
+{
+    std::vector<std::uint32_t> order = Sorting::make_order(model_table.size());
+
+    Field::dispatch(field, [&](auto tag)
+    {
+        const auto& key_column = model_table.key_column<decltype(tag)>();
+
+        Sorting::radix_sort_order(key_column.size(), [&](std::size_t row) -> decltype(auto)
+        {
+            return key_column[row];
+        }, order);
+    });
+
+    model_table.permute(order);
 
     return;
 }
 
 /**
- * @brief Builds a heap from a vector of Model objects.
+ * @brief Sorts a vector of Model objects by normalized keys using heap sort algorithm.
+ * 
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param encoder The encoder of the fields to sort by.
+ *
+ * @return The sorted keys, key `index` belongs to model `index` after the call.
+ */
+std::vector<ModelKey> Sorting::heap_sort(std::vector<Model>& model_vector, const ModelKeyEncoder& encoder)
+{
+    std::vector<ModelKey> keys = encoder.encode(model_vector);
+
+    Sorting::heap_sort_range(keys, [&](const ModelKey& l_key, const ModelKey& r_key)
+    {
+        return encoder.compare(l_key, r_key, model_vector) > 0;
+    });
+
+    Sorting::apply_keys(model_vector, keys);
+
+    return keys;
+}
+
+/**
+ * @brief Sorts a vector of Model objects by normalized keys using merge sort algorithm.
  * 
- * This function builds a heap from a vector of Model objects. The function starts at the root node of
- * a subtree and compares it with its left and right child nodes. If a child node is greater than the root
- * node, the function swaps the two nodes and continues recursively until the heap property is satisfied
- * for the entire subtree.
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param encoder The encoder of the fields to sort by.
+ *
+ * @return The sorted keys, key `index` belongs to model `index` after the call.
+ */
+std::vector<ModelKey> Sorting::merge_sort(std::vector<Model>& model_vector, const ModelKeyEncoder& encoder)
+{
+    std::vector<ModelKey> keys = encoder.encode(model_vector);
+    std::vector<ModelKey> buffer(keys.size());
+
+    if (keys.size() > 1)
+    {
+        Sorting::merge_sort_range(keys, buffer, 0, keys.size() - 1, [&](const ModelKey& l_key, const ModelKey& r_key)
+        {
+            return encoder.compare(l_key, r_key, model_vector) > 0;
+        });
+    }
+
+    Sorting::apply_keys(model_vector, keys);
+
+    return keys;
+}
+
+/**
+ * @brief Creates the identity permutation of the given size.
  * 
- * @param model_vector The vector of Model objects to build the heap from.
- * @param index The index of the root node of the subtree to build the heap from.
- * @param field The field of the Model object to sort by.
- * @param last_index The last index of the vector to consider when building the heap.
+ * @param size The number of rows.
+ * 
+ * @return The vector {0, 1, ..., size - 1}.
+ */
+std::vector<std::uint32_t> Sorting::make_order(std::size_t size)
+{
+    std::vector<std::uint32_t> order(size);
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        order[index] = index;
+    }
+
+    return order;
+}
+
+/**
+ * @brief Moves the models into the order of the sorted keys.
+ * 
+ * @param model_vector The models the keys were built from.
+ * @param keys The sorted keys, their rows are updated to the new model positions.
  * 
  * @return void.
  */
-void Sorting::make_heap(std::vector<Model>& model_vector, std::size_t index, uint8_t field, std::size_t last_index)
+void Sorting::apply_keys(std::vector<Model>& model_vector, std::vector<ModelKey>& keys)
 {
-    std::size_t biggest_index = index;
-    std::size_t left_index = (2 * biggest_index) + 1;
-    std::size_t right_index = (2 * biggest_index) + 2;
+    std::vector<Model> sorted_vector;
+    sorted_vector.reserve(model_vector.size());
 
-    if (last_index == 0)
+    for (std::size_t index = 0; index < keys.size(); ++index)
     {
-        last_index = model_vector.size();
+        sorted_vector.push_back(std::move(model_vector[keys[index].row]));
+        keys[index].row = index;
     }
 
-    if (left_index < last_index && (bool)(model_vector.at(left_index).compare_type(model_vector.at(biggest_index), field)).get_type_masked(field * 2))
+    model_vector.swap(sorted_vector);
+}
+
+/**
+ * @brief Moves the models into the given order.
+ * 
+ * @param model_vector The models to reorder.
+ * @param order The permutation, model `index` becomes what was model `order[index]`.
+ * 
+ * @return void.
+ */
+void Sorting::apply_order(std::vector<Model>& model_vector, const std::vector<std::uint32_t>& order)
+{
+    std::vector<Model> sorted_vector;
+    sorted_vector.reserve(model_vector.size());
+
+    for (std::uint32_t row : order)
     {
-        biggest_index = left_index;
+        sorted_vector.push_back(std::move(model_vector[row]));
     }
 
-    if (right_index < last_index && (bool)(model_vector.at(right_index).compare_type(model_vector.at(biggest_index), field)).get_type_masked(field * 2))
+    model_vector.swap(sorted_vector);
+}
+
+/**
+ * @brief Radix sorts a permutation of row indices by the keys of the rows.
+ * 
+ * String keys are sorted as they are. Integer-like keys are written out big-endian
+ * with the sign bit flipped, so their bytes order the same way the values do.
+ * 
+ * @param size The number of rows.
+ * @param key_of Returns the comparison key of a row.
+ * @param order The permutation to sort.
+ * 
+ * @return void.
+ */
+template<typename KeyOf>
+void Sorting::radix_sort_order(std::size_t size, KeyOf key_of, std::vector<std::uint32_t>& order)
+{
+    using Key = std::remove_cvref_t<decltype(key_of(std::size_t{0}))>;
+
+    std::vector<std::string_view> keys(size);
+    std::vector<char> key_bytes;
+
+    if constexpr (std::is_convertible_v<const Key&, std::string_view>)
+    {
+        for (std::size_t row = 0; row < size; ++row)
+        {
+            keys[row] = std::string_view(key_of(row));
+        }
+    }
+    else
     {
-        biggest_index = right_index;
+        auto to_bits = [](const Key& key)
+        {
+            if constexpr (std::is_same_v<Key, ModelDate>)
+            {
+                return static_cast<std::uint32_t>(key.days()) ^ 0x80000000u;
+            }
+            else if constexpr (std::is_signed_v<Key>)
+            {
+                using Bits = std::make_unsigned_t<Key>;
+
+                return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits{1} << (8 * sizeof(Bits) - 1)));
+            }
+            else
+            {
+                return key;
+            }
+        };
+
+        constexpr std::size_t width = sizeof(decltype(to_bits(std::declval<const Key&>())));
+
+        key_bytes.resize(size * width);
+
+        for (std::size_t row = 0; row < size; ++row)
+        {
+            auto bits = to_bits(key_of(row));
+            char* bytes = key_bytes.data() + row * width;
+
+            for (std::size_t byte = 0; byte < width; ++byte)
+            {
+                bytes[byte] = static_cast<char>(bits >> (8 * (width - 1 - byte)));
+            }
+
+            keys[row] = std::string_view(bytes, width);
+        }
     }
 
-    if (biggest_index != index)
+    if (size > 1)
     {
-        std::swap(model_vector[index], model_vector[biggest_index]);
-  
-        Sorting::make_heap(model_vector, biggest_index, field, last_index);
+        std::vector<std::uint32_t> buffer(size);
+        std::vector<std::uint16_t> characters(size);
+
+        Sorting::radix_sort_range(keys, order, buffer, characters, 0, size, 0);
     }
+}
 
-    return;
+/**
+ * @brief Radix sorts the range [begin, end) of a permutation whose keys share their first `depth` bytes.
+ * 
+ * Every row is put into one of 257 buckets by its byte at `depth`, bucket 0 holding the
+ * keys that end there, with a stable counting scatter through the buffer. Buckets are
+ * then sorted on the next byte. A range that falls into a single bucket skips the
+ * scatter, so a long shared prefix costs one pass per byte. Ranges smaller than
+ * radix_insertion_threshold are insertion sorted on the rest of their keys.
+ * 
+ * @param keys The key of every row.
+ * @param order The permutation to sort.
+ * @param buffer Scratch space of the same size as the permutation.
+ * @param characters Scratch space of the same size as the permutation, caches the bucket of every position.
+ * @param begin The first index of the range.
+ * @param end The index past the last one of the range.
+ * @param depth The length of the prefix shared by the keys of the range.
+ * 
+ * @return void.
+ */
+void Sorting::radix_sort_range(const std::vector<std::string_view>& keys, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& buffer, std::vector<std::uint16_t>& characters, std::size_t begin, std::size_t end, std::size_t depth)
+{
+    while (true)
+    {
+        if (end - begin < Sorting::radix_insertion_threshold)
+        {
+            for (std::size_t current = begin + 1; current < end; ++current)
+            {
+                std::uint32_t row = order[current];
+                std::string_view key = keys[row].substr(depth);
+                std::size_t sift = current;
+
+                while (sift > begin && key < keys[order[sift - 1]].substr(depth))
+                {
+                    order[sift] = order[sift - 1];
+                    --sift;
+                }
+
+                order[sift] = row;
+            }
+            return;
+        }
+
+        std::array<std::size_t, 257> counts{};
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            std::string_view key = keys[order[index]];
+            std::uint16_t character = (depth < key.size()) ? static_cast<std::uint16_t>(static_cast<unsigned char>(key[depth]) + 1) : 0;
+
+            characters[index] = character;
+            ++counts[character];
+        }
+
+        if (counts[characters[begin]] == end - begin)
+        {
+            if (characters[begin] == 0)
+            {
+                return;
+            }
+
+            ++depth;
+            continue;
+        }
+
+        std::array<std::size_t, 257> positions;
+        positions[0] = begin;
+
+        for (std::size_t bucket = 1; bucket < positions.size(); ++bucket)
+        {
+            positions[bucket] = positions[bucket - 1] + counts[bucket - 1];
+        }
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            buffer[positions[characters[index]]++] = order[index];
+        }
+
+        std::copy(buffer.begin() + begin, buffer.begin() + end, order.begin() + begin);
+
+        std::size_t bucket_begin = begin + counts[0];
+
+        for (std::size_t bucket = 1; bucket < counts.size(); ++bucket)
+        {
+            if (counts[bucket] > 1)
+            {
+                Sorting::radix_sort_range(keys, order, buffer, characters, bucket_begin, bucket_begin + counts[bucket], depth + 1);
+            }
+            bucket_begin += counts[bucket];
+        }
+        return;
+    }
 }
 
 /**
- * @brief Merges two sub-vectors in sorted order.
+ * @brief Heap sorts a vector of values.
  * 
- * This function is called by the merge_sort function to merge two sub-vectors in
- * sorted order. It takes the field to be sorted as input, along with the left, right
- * and middle indices of the sub-vectors to be merged.
+ * @param values The values to sort.
+ * @param greater Returns true if the left value should go after the right one.
  * 
- * @param model_vector The vector of Model objects containing the two sub-vectors to be merged.
+ * @return void.
+ */
+template<typename T, typename Greater>
+void Sorting::heap_sort_range(std::vector<T>& values, Greater greater)
+{
+    auto sift_down = [&](std::size_t index, std::size_t last_index)
+    {
+        while (true)
+        {
+            std::size_t biggest_index = index;
+            std::size_t left_index = (2 * index) + 1;
+            std::size_t right_index = (2 * index) + 2;
+
+            if (left_index < last_index && greater(values[left_index], values[biggest_index]))
+            {
+                biggest_index = left_index;
+            }
+
+            if (right_index < last_index && greater(values[right_index], values[biggest_index]))
+            {
+                biggest_index = right_index;
+            }
+
+            if (biggest_index == index)
+            {
+                return;
+            }
+
+            std::swap(values[index], values[biggest_index]);
+            index = biggest_index;
+        }
+    };
+
+    for (std::size_t index = values.size() / 2; index-- > 0;)
+    {
+        sift_down(index, values.size());
+    }
+
+    for (std::size_t index = values.size(); index-- > 1;)
+    {
+        std::swap(values[0], values[index]);
+        sift_down(0, index);
+    }
+}
+
+/**
+ * @brief Merge sorts a sub-range of a vector of values.
  * 
- * @param field The field to be sorted.
- * @param left The left index of the first sub-vector.
- * @param right The right index of the second sub-vector.
- * @param middle The middle index of the sub-vectors.
+ * @param values The values to sort.
+ * @param buffer Scratch space of the same size as the values.
+ * @param left The left index of the sub-range to be sorted.
+ * @param right The right index of the sub-range to be sorted.
+ * @param greater Returns true if the left value should go after the right one.
  * 
  * @return void.
  */
-void Sorting::make_merge(std::vector<Model>& model_vector, uint8_t field, std::size_t left, std::size_t right, std::size_t middle)
+template<typename T, typename Greater>
+void Sorting::merge_sort_range(std::vector<T>& values, std::vector<T>& buffer, std::size_t left, std::size_t right, Greater greater)
 {
-    std::size_t left_length = middle - left + 1;
-    std::size_t right_length = right - middle;
+    if (left >= right)
+    {
+        return;
+    }
+
+    std::size_t middle = left + (right - left) / 2;
+
+    Sorting::merge_sort_range(values, buffer, left, middle, greater);
+    Sorting::merge_sort_range(values, buffer, middle + 1, right, greater);
 
-    std::vector<Model> left_array;
-    std::vector<Model> right_array;
+    std::size_t i = left, j = middle + 1, k = left;
+
+    while (i <= middle && j <= right)
+    {
+        if (greater(values[i], values[j]))
+        {
+            buffer[k++] = values[j++];
+        }
+        else
+        {
+            buffer[k++] = values[i++];
+        }
+    }
 
-    for (std::size_t index = 0; index < left_length; ++index) 
+    while (i <= middle)
     {
-        left_array.push_back(model_vector.at(left + index));
+        buffer[k++] = values[i++];
     }
 
-    for (std::size_t index = 0; index < right_length; ++index) 
+    while (j <= right)
     {
-        right_array.push_back(model_vector.at(middle + index + 1));
+        buffer[k++] = values[j++];
     }
 
-    std::size_t i = 0, j = 0, k = left;
+    std::copy(buffer.begin() + left, buffer.begin() + right + 1, values.begin() + left);
+}
+
+/**
+ * @brief Bubble sorts a permutation of row indices by the values of the key column.
+ * 
+ * @param column The key column.
+ * @param order The permutation to sort.
+ * 
+ * @return void.
+ */
+template<typename Column>
+void Sorting::bubble_sort_order(const Column& column, std::vector<std::uint32_t>& order)
+{
+    bool has_changed;
 
-    while (i < left_length && j < right_length) 
+    if (order.size() < 2)
     {
-        if ((bool)(right_array.at(j).compare_type(left_array.at(i), field)).get_type_masked(field * 2))
+        return;
+    }
+
+    do
+    {
+        has_changed = false;
+
+        for (std::size_t index = 0; index < order.size() - 1; ++index)
         {
-            model_vector[k++] = left_array[i++];
-        } 
-        else 
+            if (column[order[index]] > column[order[index + 1]])
+            {
+                std::swap(order[index], order[index + 1]);
+                has_changed = true;
+            }
+        }
+    }
+    while (has_changed);
+
+    return;
+}
+
+/**
+ * @brief Heap sorts a permutation of row indices by the values of the key column.
+ * 
+ * @param column The key column.
+ * @param order The permutation to sort.
+ * 
+ * @return void.
+ */
+template<typename Column>
+void Sorting::heap_sort_order(const Column& column, std::vector<std::uint32_t>& order)
+{
+    for (std::size_t index = order.size() / 2; index-- > 0;)
+    {
+        Sorting::make_heap_order(column, order, index, order.size());
+    }
+
+    for (std::size_t index = order.size(); index-- > 1;)
+    {
+        std::swap(order[0], order[index]);
+        Sorting::make_heap_order(column, order, 0, index);
+    }
+
+    return;
+}
+
+/**
+ * @brief Sifts a row index down the heap built over the key column.
+ * 
+ * @param column The key column.
+ * @param order The permutation holding the heap.
+ * @param index The index of the root node of the subtree.
+ * @param last_index The number of heap elements.
+ * 
+ * @return void.
+ */
+template<typename Column>
+void Sorting::make_heap_order(const Column& column, std::vector<std::uint32_t>& order, std::size_t index, std::size_t last_index)
+{
+    while (true)
+    {
+        std::size_t biggest_index = index;
+        std::size_t left_index = (2 * index) + 1;
+        std::size_t right_index = (2 * index) + 2;
+
+        if (left_index < last_index && column[order[left_index]] > column[order[biggest_index]])
+        {
+            biggest_index = left_index;
+        }
+
+        if (right_index < last_index && column[order[right_index]] > column[order[biggest_index]])
+        {
+            biggest_index = right_index;
+        }
+
+        if (biggest_index == index)
+        {
+            return;
+        }
+
+        std::swap(order[index], order[biggest_index]);
+        index = biggest_index;
+    }
+}
+
+/**
+ * @brief Merge sorts a permutation of row indices by the values of the key column.
+ * 
+ * @param column The key column.
+ * @param order The permutation to sort.
+ * @param buffer Scratch space of the same size as the permutation.
+ * @param left The left index of the sub-range to be sorted.
+ * @param right The right index of the sub-range to be sorted.
+ * 
+ * @return void.
+ */
+template<typename Column>
+void Sorting::merge_sort_order(const Column& column, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& buffer, std::size_t left, std::size_t right)
+{
+    if (left >= right)
+    {
+        return;
+    }
+
+    std::size_t middle = left + (right - left) / 2;
+
+    Sorting::merge_sort_order(column, order, buffer, left, middle);
+    Sorting::merge_sort_order(column, order, buffer, middle + 1, right);
+
+    std::size_t i = left, j = middle + 1, k = left;
+
+    while (i <= middle && j <= right)
+    {
+        if (column[order[i]] > column[order[j]])
+        {
+            buffer[k++] = order[j++];
+        }
+        else
         {
-            model_vector[k++] = right_array[j++];
+            buffer[k++] = order[i++];
         }
     }
 
-    while (i < left_length) 
+    while (i <= middle)
     {
-        model_vector[k++] = left_array[i++];
+        buffer[k++] = order[i++];
     }
 
-    while (j < right_length) 
+    while (j <= right)
     {
-        model_vector[k++] = right_array[j++];
+        buffer[k++] = order[j++];
     }
-}
\ No newline at end of file
+
+    std::copy(buffer.begin() + left, buffer.begin() + right + 1, order.begin() + left);
+}
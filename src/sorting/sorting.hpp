@@ -24,14 +24,48 @@
 #include "../model/model.hpp"
 #endif // MODEL_HPP
 
+#ifndef MODEL_TABLE_HPP
+#include "../model/model_table.hpp"
+#endif // MODEL_TABLE_HPP
+
+#ifndef MODEL_KEY_HPP
+#include "../model/model_key.hpp"
+#endif // MODEL_KEY_HPP
+
+#ifndef WORK_STEALING_POOL_HPP
+#include "work_stealing_pool.hpp"
+#endif // WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <bit>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 /**
  * @class Sorting
  *
  * @brief A class that provides static sorting methods for sorting a vector of Model objects based on a specific field.
  * 
- * @note Currently provides implementations for bubble sort, heap sort, and merge sort.
+ * @note Currently provides implementations for bubble sort, heap sort, merge sort and fast
+ *       sort, a pattern-defeating quicksort (pdqsort) meant for real workloads.
+ * 
+ * @note Radix sort orders row indices by the bytes of the keys, most significant first,
+ *       and moves the models or columns once at the end.
+ * 
+ * @note Parallel merge sort runs on a WorkStealingPool and gives exactly the result of
+ *       merge sort, both being stable.
+ * 
+ * @note ModelTable overloads sort a permutation of row indices by the key column only
+ *       and then reorder every column once.
+ * 
+ * @note Overloads templated on field tags compare the selected fields directly through
+ *       Records::compare, further tags break ties. They accept a vector of any record
+ *       type with a RecordSchema, the Field tags being the schema of Model. The overloads
+ *       taking a runtime field number convert it to a tag once per call.
+ * 
+ * @note ModelKeyEncoder overloads sort normalized 16-byte keys and reorder the models
+ *       once afterwards, the models themselves are only compared on key ties.
  */
 class Sorting
 {
@@ -39,10 +73,1064 @@ public:
     static void bubble_sort(std::vector<Model>& model_vector, uint8_t field);
     static void heap_sort(std::vector<Model>& model_vector, uint8_t field);
     static void merge_sort(std::vector<Model>& model_vector, uint8_t field, std::size_t left = 0, std::size_t right = 0, bool initial = true);
+    static void fast_sort(std::vector<Model>& model_vector, uint8_t field);
+    static void radix_sort(std::vector<Model>& model_vector, uint8_t field);
+    static void parallel_merge_sort(std::vector<Model>& model_vector, uint8_t field, std::size_t threads = 0);
+    static void parallel_merge_sort(std::vector<Model>& model_vector, uint8_t field, WorkStealingPool& pool, std::vector<Model>& buffer);
+
+    static void bubble_sort(ModelTable& model_table, uint8_t field);
+    static void heap_sort(ModelTable& model_table, uint8_t field);
+    static void merge_sort(ModelTable& model_table, uint8_t field);
+    static void radix_sort(ModelTable& model_table, uint8_t field);
+
+    static std::vector<ModelKey> heap_sort(std::vector<Model>& model_vector, const ModelKeyEncoder& encoder);
+    static std::vector<ModelKey> merge_sort(std::vector<Model>& model_vector, const ModelKeyEncoder& encoder);
+
+    template<typename F, typename... Fs, typename Record>
+        static void bubble_sort(std::vector<Record>& model_vector);
+    template<typename F, typename... Fs, typename Record>
+        static void heap_sort(std::vector<Record>& model_vector);
+    template<typename F, typename... Fs, typename Record>
+        static void merge_sort(std::vector<Record>& model_vector, std::size_t left = 0, std::size_t right = 0, bool initial = true);
+    template<typename F, typename... Fs, typename Record>
+        static void fast_sort(std::vector<Record>& model_vector);
+    template<typename F, typename... Fs, typename Record>
+        static void parallel_merge_sort(std::vector<Record>& model_vector, std::size_t threads = 0);
+    template<typename F, typename... Fs, typename Record>
+        static void parallel_merge_sort(std::vector<Record>& model_vector, WorkStealingPool& pool, std::vector<Record>& buffer);
 
 private:
-    static void make_heap(std::vector<Model>& model_vector, std::size_t index, uint8_t field, std::size_t last_index = 0);
-    static void make_merge(std::vector<Model>& model_vector, uint8_t field, std::size_t left, std::size_t right, std::size_t middle);
+    static constexpr std::size_t insertion_sort_threshold = 24;         ///< Partitions smaller than this are insertion sorted.
+    static constexpr std::size_t ninther_threshold = 128;               ///< Partitions larger than this take the pivot as a ninther.
+    static constexpr std::size_t partial_insertion_sort_limit = 8;      ///< Moves after which the insertion sort of a partition that looks sorted gives up.
+    static constexpr std::size_t partition_block_size = 64;             ///< Elements classified per block by the branchless partition.
+    static constexpr std::size_t radix_insertion_threshold = 32;        ///< Radix buckets smaller than this are insertion sorted.
+    static constexpr std::size_t merge_run_size = 32;                   ///< Runs the parallel merge sort insertion sorts before merging.
+    static constexpr std::size_t parallel_sort_grain = 8192;            ///< Ranges up to this size are sorted by a single task.
+    static constexpr std::size_t parallel_merge_grain = 16384;          ///< Least number of records a merge task produces.
+
+    template<typename F, typename... Fs, typename Record>
+        static void make_heap(std::vector<Record>& model_vector, std::size_t index, std::size_t last_index);
+    template<typename F, typename... Fs, typename Record>
+        static void make_merge(std::vector<Record>& model_vector, std::size_t left, std::size_t right, std::size_t middle);
+
+    template<bool Branchless, typename Record, typename Less>
+        static void fast_sort_range(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less, std::size_t bad_allowed, bool leftmost);
+    template<typename Record, typename Less>
+        static void sort_three(std::vector<Record>& model_vector, std::size_t first, std::size_t second, std::size_t third, Less less);
+    template<typename Record, typename Less>
+        static void insertion_sort(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less, bool guarded);
+    template<typename Record, typename Less>
+        static bool partial_insertion_sort(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less);
+    template<typename Record, typename Less>
+        static void heap_sort_slice(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less);
+    template<typename Record, typename Less>
+        static std::pair<std::size_t, bool> partition_right(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less);
+    template<typename Record, typename Less>
+        static std::pair<std::size_t, bool> partition_right_branchless(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less);
+    template<typename Record, typename Less>
+        static std::size_t partition_left(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less);
+
+    template<typename Record, typename Less>
+        static void parallel_merge_sort_range(WorkStealingPool& pool, std::vector<Record>& values, std::vector<Record>& buffer, std::size_t begin, std::size_t end, bool to_buffer, Less less);
+    template<typename Record, typename Less>
+        static void parallel_merge(WorkStealingPool& pool, std::vector<Record>& source, std::vector<Record>& target, std::size_t begin, std::size_t middle, std::size_t end, Less less);
+    template<typename Record, typename Less>
+        static void merge_runs(std::vector<Record>& source, std::size_t left, std::size_t left_end, std::size_t right, std::size_t right_end, std::vector<Record>& target, std::size_t output, Less less);
+
+
+    static std::vector<std::uint32_t> make_order(std::size_t size);
+    static void apply_keys(std::vector<Model>& model_vector, std::vector<ModelKey>& keys);
+    static void apply_order(std::vector<Model>& model_vector, const std::vector<std::uint32_t>& order);
+
+    template<typename KeyOf>
+        static void radix_sort_order(std::size_t size, KeyOf key_of, std::vector<std::uint32_t>& order);
+    static void radix_sort_range(const std::vector<std::string_view>& keys, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& buffer, std::vector<std::uint16_t>& characters, std::size_t begin, std::size_t end, std::size_t depth);
+
+    template<typename T, typename Greater>
+        static void heap_sort_range(std::vector<T>& values, Greater greater);
+    template<typename T, typename Greater>
+        static void merge_sort_range(std::vector<T>& values, std::vector<T>& buffer, std::size_t left, std::size_t right, Greater greater);
+
+    template<typename Column>
+        static void bubble_sort_order(const Column& column, std::vector<std::uint32_t>& order);
+    template<typename Column>
+        static void heap_sort_order(const Column& column, std::vector<std::uint32_t>& order);
+    template<typename Column>
+        static void make_heap_order(const Column& column, std::vector<std::uint32_t>& order, std::size_t index, std::size_t last_index);
+    template<typename Column>
+        static void merge_sort_order(const Column& column, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& buffer, std::size_t left, std::size_t right);
 };
 
+/**
+ * @brief Sorts the given vector of Model objects using bubble sort algorithm.
+ * 
+ * @tparam F The tag of the field to be used for sorting the objects.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ *
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::bubble_sort(std::vector<Record>& model_vector)
+{
+    bool has_changed;
+
+    if (model_vector.size() < 2)
+    {
+        return;
+    }
+
+    do
+    {
+        has_changed = false;
+
+        for (std::size_t index = 0; index < model_vector.size() - 1; ++index)
+        {
+            if (Records::compare<F, Fs...>(model_vector[index], model_vector[index + 1]) > 0)
+            {
+                std::swap(model_vector[index], model_vector[index + 1]);
+                has_changed = true;
+            }
+        }
+    }
+    while (has_changed);
+
+    return;
+}
+
+/**
+ * @brief Performs heap sort on a vector of Model objects.
+ * 
+ * @tparam F The tag of the field to sort by.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ *
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::heap_sort(std::vector<Record>& model_vector)
+{
+    for (std::size_t index = model_vector.size() / 2; index-- > 0;)
+    {
+        Sorting::make_heap<F, Fs...>(model_vector, index, model_vector.size());
+    }
+
+    for (std::size_t index = model_vector.size(); index-- > 1;)
+    {
+        std::swap(model_vector[0], model_vector[index]);
+        Sorting::make_heap<F, Fs...>(model_vector, 0, index);
+    }
+
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using merge sort algorithm.
+ * 
+ * @tparam F The tag of the field to be sorted.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param left The left index of the sub-vector to be sorted (default is 0).
+ * @param right The right index of the sub-vector to be sorted (default is size-1).
+ * @param initial A boolean flag indicating whether this is the initial call to the function (default is true).
+ * 
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::merge_sort(std::vector<Record>& model_vector, std::size_t left, std::size_t right, bool initial)
+{
+    if (initial)
+    {
+        if (model_vector.empty())
+        {
+            return;
+        }
+
+        left = 0;
+        right = model_vector.size() - 1;
+    }
+
+    if (left >= right)
+    {
+        return;
+    }
+
+    std::size_t middle = left + (right - left) / 2;
+
+    Sorting::merge_sort<F, Fs...>(model_vector, left, middle, false);
+    Sorting::merge_sort<F, Fs...>(model_vector, middle + 1, right, false);
+    Sorting::make_merge<F, Fs...>(model_vector, left, right, middle);
+
+    return;
+}
+
+/**
+ * @brief Sifts an element down the heap built over a vector of Model objects.
+ * 
+ * @tparam F The tag of the field to sort by.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects holding the heap.
+ * @param index The index of the root node of the subtree.
+ * @param last_index The number of heap elements.
+ * 
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::make_heap(std::vector<Record>& model_vector, std::size_t index, std::size_t last_index)
+{
+    while (true)
+    {
+        std::size_t biggest_index = index;
+        std::size_t left_index = (2 * index) + 1;
+        std::size_t right_index = (2 * index) + 2;
+
+        if (left_index < last_index && Records::compare<F, Fs...>(model_vector[left_index], model_vector[biggest_index]) > 0)
+        {
+            biggest_index = left_index;
+        }
+
+        if (right_index < last_index && Records::compare<F, Fs...>(model_vector[right_index], model_vector[biggest_index]) > 0)
+        {
+            biggest_index = right_index;
+        }
+
+        if (biggest_index == index)
+        {
+            return;
+        }
+
+        std::swap(model_vector[index], model_vector[biggest_index]);
+        index = biggest_index;
+    }
+}
+
+/**
+ * @brief Merges two sub-vectors in sorted order.
+ * 
+ * Models are moved into the temporary halves and back, so only the two halves
+ * themselves are allocated.
+ * 
+ * @tparam F The tag of the field to be sorted.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects containing the two sub-vectors to be merged.
+ * @param left The left index of the first sub-vector.
+ * @param right The right index of the second sub-vector.
+ * @param middle The middle index of the sub-vectors.
+ * 
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::make_merge(std::vector<Record>& model_vector, std::size_t left, std::size_t right, std::size_t middle)
+{
+    std::size_t left_length = middle - left + 1;
+    std::size_t right_length = right - middle;
+
+    std::vector<Record> left_array;
+    std::vector<Record> right_array;
+
+    left_array.reserve(left_length);
+    right_array.reserve(right_length);
+
+    for (std::size_t index = 0; index < left_length; ++index)
+    {
+        left_array.push_back(std::move(model_vector[left + index]));
+    }
+
+    for (std::size_t index = 0; index < right_length; ++index)
+    {
+        right_array.push_back(std::move(model_vector[middle + index + 1]));
+    }
+
+    std::size_t i = 0, j = 0, k = left;
+
+    while (i < left_length && j < right_length)
+    {
+        if (Records::compare<F, Fs...>(left_array[i], right_array[j]) > 0)
+        {
+            model_vector[k++] = std::move(right_array[j++]);
+        }
+        else
+        {
+            model_vector[k++] = std::move(left_array[i++]);
+        }
+    }
+
+    while (i < left_length)
+    {
+        model_vector[k++] = std::move(left_array[i++]);
+    }
+
+    while (j < right_length)
+    {
+        model_vector[k++] = std::move(right_array[j++]);
+    }
+}
+
+/**
+ * @brief Sorts a vector of Model objects using pattern-defeating quicksort.
+ * 
+ * Quicksort with a median of three pivot, or a ninther on large partitions, and
+ * insertion sort below insertion_sort_threshold elements. A partition that comes out
+ * highly unbalanced shuffles a few elements to break the pattern, and once that has
+ * happened log2(n) times the range is heap sorted, so the worst case stays O(n log n).
+ * Runs of equal keys are split off in linear time and already sorted input is detected
+ * after the first partition.
+ * 
+ * When the only key is integer-like (a date or a dictionary rank) elements are
+ * classified against the pivot a block at a time into offset buffers, which turns the
+ * unpredictable branch of every comparison into arithmetic.
+ * 
+ * The sort is not stable.
+ * 
+ * @tparam F The tag of the field to sort by.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ *
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::fast_sort(std::vector<Record>& model_vector)
+{
+    using Key = RecordKey<F, Record>;
+
+    constexpr bool branchless = sizeof...(Fs) == 0 && (std::is_integral_v<Key> || std::is_same_v<Key, ModelDate>);
+
+    if (model_vector.size() < 2)
+    {
+        return;
+    }
+
+    auto less = [](const Record& l_record, const Record& r_record)
+    {
+        return Records::compare<F, Fs...>(l_record, r_record) < 0;
+    };
+
+    Sorting::fast_sort_range<branchless>(model_vector, 0, model_vector.size(), less, std::bit_width(model_vector.size()) - 1, true);
+
+    return;
+}
+
+/**
+ * @brief Sorts the range [begin, end) of a vector of records using pattern-defeating quicksort.
+ * 
+ * @tparam Branchless Whether to use the block partition.
+ * @tparam Record The record type.
+ * @tparam Less Returns true if the left record goes before the right one.
+ * @param model_vector The vector holding the range.
+ * @param begin The first index of the range.
+ * @param end The index past the last one of the range.
+ * @param less The comparison.
+ * @param bad_allowed Highly unbalanced partitions left before falling back to heap sort.
+ * @param leftmost Whether the range starts the vector, otherwise the record before it is not greater than any in it.
+ * 
+ * @return void.
+ */
+template<bool Branchless, typename Record, typename Less>
+void Sorting::fast_sort_range(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less, std::size_t bad_allowed, bool leftmost)
+{
+    while (true)
+    {
+        std::size_t size = end - begin;
+
+        if (size < Sorting::insertion_sort_threshold)
+        {
+            Sorting::insertion_sort(model_vector, begin, end, less, leftmost);
+            return;
+        }
+
+        std::size_t half = size / 2;
+
+        if (size > Sorting::ninther_threshold)
+        {
+            Sorting::sort_three(model_vector, begin, begin + half, end - 1, less);
+            Sorting::sort_three(model_vector, begin + 1, begin + half - 1, end - 2, less);
+            Sorting::sort_three(model_vector, begin + 2, begin + half + 1, end - 3, less);
+            Sorting::sort_three(model_vector, begin + half - 1, begin + half, begin + half + 1, less);
+            std::swap(model_vector[begin], model_vector[begin + half]);
+        }
+        else
+        {
+            Sorting::sort_three(model_vector, begin + half, begin, end - 1, less);
+        }
+
+        // A pivot equal to the record before the range is the smallest key in it, so every
+        // record equal to the pivot is put into place at once.
+        if (!leftmost && !less(model_vector[begin - 1], model_vector[begin]))
+        {
+            begin = Sorting::partition_left(model_vector, begin, end, less) + 1;
+            continue;
+        }
+
+        std::pair<std::size_t, bool> partition;
+
+        if constexpr (Branchless)
+        {
+            partition = Sorting::partition_right_branchless(model_vector, begin, end, less);
+        }
+        else
+        {
+            partition = Sorting::partition_right(model_vector, begin, end, less);
+        }
+
+        std::size_t pivot = partition.first;
+        std::size_t left_size = pivot - begin;
+        std::size_t right_size = end - (pivot + 1);
+
+        if (left_size < size / 8 || right_size < size / 8)
+        {
+            if (--bad_allowed == 0)
+            {
+                Sorting::heap_sort_slice(model_vector, begin, end, less);
+                return;
+            }
+
+            if (left_size >= Sorting::insertion_sort_threshold)
+            {
+                std::swap(model_vector[begin], model_vector[begin + left_size / 4]);
+                std::swap(model_vector[pivot - 1], model_vector[pivot - left_size / 4]);
+
+                if (left_size > Sorting::ninther_threshold)
+                {
+                    std::swap(model_vector[begin + 1], model_vector[begin + (left_size / 4 + 1)]);
+                    std::swap(model_vector[begin + 2], model_vector[begin + (left_size / 4 + 2)]);
+                    std::swap(model_vector[pivot - 2], model_vector[pivot - (left_size / 4 + 1)]);
+                    std::swap(model_vector[pivot - 3], model_vector[pivot - (left_size / 4 + 2)]);
+                }
+            }
+
+            if (right_size >= Sorting::insertion_sort_threshold)
+            {
+                std::swap(model_vector[pivot + 1], model_vector[pivot + (1 + right_size / 4)]);
+                std::swap(model_vector[end - 1], model_vector[end - right_size / 4]);
+
+                if (right_size > Sorting::ninther_threshold)
+                {
+                    std::swap(model_vector[pivot + 2], model_vector[pivot + (2 + right_size / 4)]);
+                    std::swap(model_vector[pivot + 3], model_vector[pivot + (3 + right_size / 4)]);
+                    std::swap(model_vector[end - 2], model_vector[end - (1 + right_size / 4)]);
+                    std::swap(model_vector[end - 3], model_vector[end - (2 + right_size / 4)]);
+                }
+            }
+        }
+        else if (partition.second && Sorting::partial_insertion_sort(model_vector, begin, pivot, less) && Sorting::partial_insertion_sort(model_vector, pivot + 1, end, less))
+        {
+            return;
+        }
+
+        Sorting::fast_sort_range<Branchless>(model_vector, begin, pivot, less, bad_allowed, leftmost);
+
+        begin = pivot + 1;
+        leftmost = false;
+    }
+}
+
+/**
+ * @brief Sorts three records of a vector in place.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::sort_three(std::vector<Record>& model_vector, std::size_t first, std::size_t second, std::size_t third, Less less)
+{
+    if (less(model_vector[second], model_vector[first]))
+    {
+        std::swap(model_vector[first], model_vector[second]);
+    }
+
+    if (less(model_vector[third], model_vector[second]))
+    {
+        std::swap(model_vector[second], model_vector[third]);
+    }
+
+    if (less(model_vector[second], model_vector[first]))
+    {
+        std::swap(model_vector[first], model_vector[second]);
+    }
+}
+
+/**
+ * @brief Insertion sorts the range [begin, end) of a vector of records.
+ * 
+ * @param guarded Whether to check the start of the range, otherwise the record before it stops every shift.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::insertion_sort(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less, bool guarded)
+{
+    for (std::size_t current = begin + 1; current < end; ++current)
+    {
+        if (less(model_vector[current], model_vector[current - 1]))
+        {
+            Record value = std::move(model_vector[current]);
+            std::size_t sift = current;
+
+            do
+            {
+                model_vector[sift] = std::move(model_vector[sift - 1]);
+                --sift;
+            }
+            while ((!guarded || sift != begin) && less(value, model_vector[sift - 1]));
+
+            model_vector[sift] = std::move(value);
+        }
+    }
+}
+
+/**
+ * @brief Insertion sorts the range [begin, end) of a vector of records unless it takes too many moves.
+ * 
+ * @return True if the range is sorted, false if the sort gave up after partial_insertion_sort_limit moves.
+ */
+template<typename Record, typename Less>
+bool Sorting::partial_insertion_sort(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less)
+{
+    std::size_t moves = 0;
+
+    for (std::size_t current = begin + 1; current < end; ++current)
+    {
+        if (less(model_vector[current], model_vector[current - 1]))
+        {
+            Record value = std::move(model_vector[current]);
+            std::size_t sift = current;
+
+            do
+            {
+                model_vector[sift] = std::move(model_vector[sift - 1]);
+                --sift;
+            }
+            while (sift != begin && less(value, model_vector[sift - 1]));
+
+            model_vector[sift] = std::move(value);
+            moves += current - sift;
+        }
+
+        if (moves > Sorting::partial_insertion_sort_limit)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Heap sorts the range [begin, end) of a vector of records.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::heap_sort_slice(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less)
+{
+    auto sift_down = [&](std::size_t index, std::size_t last_index)
+    {
+        while (true)
+        {
+            std::size_t biggest_index = index;
+            std::size_t left_index = (2 * index) + 1;
+            std::size_t right_index = (2 * index) + 2;
+
+            if (left_index < last_index && less(model_vector[begin + biggest_index], model_vector[begin + left_index]))
+            {
+                biggest_index = left_index;
+            }
+
+            if (right_index < last_index && less(model_vector[begin + biggest_index], model_vector[begin + right_index]))
+            {
+                biggest_index = right_index;
+            }
+
+            if (biggest_index == index)
+            {
+                return;
+            }
+
+            std::swap(model_vector[begin + index], model_vector[begin + biggest_index]);
+            index = biggest_index;
+        }
+    };
+
+    std::size_t size = end - begin;
+
+    for (std::size_t index = size / 2; index-- > 0;)
+    {
+        sift_down(index, size);
+    }
+
+    for (std::size_t index = size; index-- > 1;)
+    {
+        std::swap(model_vector[begin], model_vector[begin + index]);
+        sift_down(0, index);
+    }
+}
+
+/**
+ * @brief Partitions the range [begin, end) around its first record, records equal to it go right.
+ * 
+ * The range holds a record not less than the pivot after it, and unless the pivot is
+ * the first record of the vector, one not greater before it, so the scans need no
+ * bounds checks.
+ * 
+ * @return The position of the pivot and whether the range was already partitioned.
+ */
+template<typename Record, typename Less>
+std::pair<std::size_t, bool> Sorting::partition_right(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less)
+{
+    Record pivot = std::move(model_vector[begin]);
+
+    std::size_t first = begin;
+    std::size_t last = end;
+
+    while (less(model_vector[++first], pivot));
+
+    if (first - 1 == begin)
+    {
+        while (first < last && !less(model_vector[--last], pivot));
+    }
+    else
+    {
+        while (!less(model_vector[--last], pivot));
+    }
+
+    bool already_partitioned = first >= last;
+
+    while (first < last)
+    {
+        std::swap(model_vector[first], model_vector[last]);
+
+        while (less(model_vector[++first], pivot));
+        while (!less(model_vector[--last], pivot));
+    }
+
+    std::size_t pivot_position = first - 1;
+
+    model_vector[begin] = std::move(model_vector[pivot_position]);
+    model_vector[pivot_position] = std::move(pivot);
+
+    return {pivot_position, already_partitioned};
+}
+
+/**
+ * @brief Same as partition_right, but classifies records against the pivot a block at a time.
+ * 
+ * Positions of misplaced records are written to two offset buffers unconditionally and
+ * the buffer length is advanced by the comparison result, so the classification loop
+ * has no data-dependent branch. Misplaced records are then swapped pairwise.
+ * 
+ * @return The position of the pivot and whether the range was already partitioned.
+ */
+template<typename Record, typename Less>
+std::pair<std::size_t, bool> Sorting::partition_right_branchless(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less)
+{
+    Record pivot = std::move(model_vector[begin]);
+
+    std::size_t first = begin;
+    std::size_t last = end;
+
+    while (less(model_vector[++first], pivot));
+
+    if (first - 1 == begin)
+    {
+        while (first < last && !less(model_vector[--last], pivot));
+    }
+    else
+    {
+        while (!less(model_vector[--last], pivot));
+    }
+
+    bool already_partitioned = first >= last;
+
+    if (!already_partitioned)
+    {
+        std::swap(model_vector[first], model_vector[last]);
+        ++first;
+
+        alignas(64) unsigned char left_offsets[Sorting::partition_block_size];
+        alignas(64) unsigned char right_offsets[Sorting::partition_block_size];
+
+        std::size_t left_base = first;
+        std::size_t right_base = last;
+        std::size_t left_count = 0;
+        std::size_t right_count = 0;
+        std::size_t left_start = 0;
+        std::size_t right_start = 0;
+
+        while (first < last)
+        {
+            std::size_t unknown = last - first;
+            std::size_t left_split = (left_count == 0) ? ((right_count == 0) ? unknown / 2 : unknown) : 0;
+            std::size_t right_split = (right_count == 0) ? unknown - left_split : 0;
+
+            for (std::size_t offset = 0; offset < std::min(left_split, Sorting::partition_block_size); ++offset)
+            {
+                left_offsets[left_count] = static_cast<unsigned char>(offset);
+                left_count += !less(model_vector[first], pivot);
+                ++first;
+            }
+
+            for (std::size_t offset = 1; offset <= std::min(right_split, Sorting::partition_block_size); ++offset)
+            {
+                right_offsets[right_count] = static_cast<unsigned char>(offset);
+                right_count += less(model_vector[--last], pivot);
+            }
+
+            std::size_t count = std::min(left_count, right_count);
+
+            if (left_count == right_count)
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    std::swap(model_vector[left_base + left_offsets[left_start + index]], model_vector[right_base - right_offsets[right_start + index]]);
+                }
+            }
+            else if (count > 0)
+            {
+                // One cycle through the misplaced records moves each once instead of swapping.
+                std::size_t left = left_base + left_offsets[left_start];
+                std::size_t right = right_base - right_offsets[right_start];
+
+                Record value = std::move(model_vector[left]);
+                model_vector[left] = std::move(model_vector[right]);
+
+                for (std::size_t index = 1; index < count; ++index)
+                {
+                    left = left_base + left_offsets[left_start + index];
+                    model_vector[right] = std::move(model_vector[left]);
+                    right = right_base - right_offsets[right_start + index];
+                    model_vector[left] = std::move(model_vector[right]);
+                }
+
+                model_vector[right] = std::move(value);
+            }
+
+            left_count -= count;
+            right_count -= count;
+            left_start += count;
+            right_start += count;
+
+            if (left_count == 0)
+            {
+                left_start = 0;
+                left_base = first;
+            }
+
+            if (right_count == 0)
+            {
+                right_start = 0;
+                right_base = last;
+            }
+        }
+
+        if (left_count != 0)
+        {
+            while (left_count-- > 0)
+            {
+                std::swap(model_vector[left_base + left_offsets[left_start + left_count]], model_vector[--last]);
+            }
+            first = last;
+        }
+
+        if (right_count != 0)
+        {
+            while (right_count-- > 0)
+            {
+                std::swap(model_vector[right_base - right_offsets[right_start + right_count]], model_vector[first]);
+                ++first;
+            }
+            last = first;
+        }
+    }
+
+    std::size_t pivot_position = first - 1;
+
+    model_vector[begin] = std::move(model_vector[pivot_position]);
+    model_vector[pivot_position] = std::move(pivot);
+
+    return {pivot_position, already_partitioned};
+}
+
+/**
+ * @brief Partitions the range [begin, end) around its first record, records equal to it go left.
+ * 
+ * Only called when the record before the range equals the pivot, in which case no
+ * record of the range is less than the pivot and the left part is all equal keys.
+ * 
+ * @return The position of the pivot.
+ */
+template<typename Record, typename Less>
+std::size_t Sorting::partition_left(std::vector<Record>& model_vector, std::size_t begin, std::size_t end, Less less)
+{
+    Record pivot = std::move(model_vector[begin]);
+
+    std::size_t first = begin;
+    std::size_t last = end;
+
+    while (less(pivot, model_vector[--last]));
+
+    if (last + 1 == end)
+    {
+        while (first < last && !less(pivot, model_vector[++first]));
+    }
+    else
+    {
+        while (!less(pivot, model_vector[++first]));
+    }
+
+    while (first < last)
+    {
+        std::swap(model_vector[first], model_vector[last]);
+
+        while (less(pivot, model_vector[--last]));
+        while (!less(pivot, model_vector[++first]));
+    }
+
+    model_vector[begin] = std::move(model_vector[last]);
+    model_vector[last] = std::move(pivot);
+
+    return last;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using merge sort on several threads.
+ * 
+ * The recursion forks both halves of every range above parallel_sort_grain records on
+ * a WorkStealingPool and insertion sorts runs of merge_run_size. Records alternate
+ * between the vector and one buffer from level to level instead of being copied into
+ * temporary halves. Large merges are cut along their merge path into pieces that are
+ * merged in parallel, so the last merges use every thread as well.
+ * 
+ * Like merge_sort the sort is stable, so both give exactly the same order.
+ * 
+ * This overload starts a pool and allocates a buffer for a single sort, callers that
+ * sort repeatedly should keep both and use the overload taking them.
+ * 
+ * @tparam F The tag of the field to be sorted.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param threads The number of threads, 0 for every hardware thread.
+ * 
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::parallel_merge_sort(std::vector<Record>& model_vector, std::size_t threads)
+{
+    if (model_vector.size() < 2)
+    {
+        return;
+    }
+
+    WorkStealingPool pool((model_vector.size() > Sorting::parallel_sort_grain) ? threads : 1);
+    std::vector<Record> buffer;
+
+    Sorting::parallel_merge_sort<F, Fs...>(model_vector, pool, buffer);
+
+    return;
+}
+
+/**
+ * @brief Sorts a vector of Model objects using merge sort on the threads of a pool.
+ * 
+ * The records are moved into the buffer, which is cleared again afterwards, so its
+ * capacity is reused by the next sort and no thread is started.
+ * 
+ * @tparam F The tag of the field to be sorted.
+ * @tparam Fs The tags of the tie-breaking fields.
+ * @tparam Record The record type, deduced from the vector.
+ * @param model_vector The vector of Model objects to be sorted.
+ * @param pool The pool to sort on.
+ * @param buffer Scratch storage kept by the caller, empty after the sort.
+ * 
+ * @return void.
+ */
+template<typename F, typename... Fs, typename Record>
+void Sorting::parallel_merge_sort(std::vector<Record>& model_vector, WorkStealingPool& pool, std::vector<Record>& buffer)
+{
+    if (model_vector.size() < 2)
+    {
+        return;
+    }
+
+    auto less = [](const Record& l_record, const Record& r_record)
+    {
+        return Records::compare<F, Fs...>(l_record, r_record) < 0;
+    };
+
+    buffer.clear();
+    buffer.reserve(model_vector.size());
+
+    for (Record& record : model_vector)
+    {
+        buffer.push_back(std::move(record));
+    }
+
+    Sorting::parallel_merge_sort_range(pool, buffer, model_vector, 0, buffer.size(), true, less);
+
+    buffer.clear();
+
+    return;
+}
+
+/**
+ * @brief Sorts the range [begin, end) of the values into the values or into the buffer.
+ * 
+ * Only leaves read the values, so both halves of a range are sorted into the array
+ * the range is not sorted into and merged from there.
+ * 
+ * @param pool The pool to fork on.
+ * @param values The unsorted records.
+ * @param buffer The other array, same size as the values.
+ * @param begin The first index of the range.
+ * @param end The index past the last one of the range.
+ * @param to_buffer Whether the sorted range goes into the buffer.
+ * @param less The comparison.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::parallel_merge_sort_range(WorkStealingPool& pool, std::vector<Record>& values, std::vector<Record>& buffer, std::size_t begin, std::size_t end, bool to_buffer, Less less)
+{
+    std::size_t size = end - begin;
+
+    if (size <= Sorting::merge_run_size)
+    {
+        Sorting::insertion_sort(values, begin, end, less, true);
+
+        if (to_buffer)
+        {
+            std::move(values.begin() + begin, values.begin() + end, buffer.begin() + begin);
+        }
+        return;
+    }
+
+    std::size_t middle = begin + size / 2;
+
+    auto sort_left = [&]()
+    {
+        Sorting::parallel_merge_sort_range(pool, values, buffer, begin, middle, !to_buffer, less);
+    };
+
+    auto sort_right = [&]()
+    {
+        Sorting::parallel_merge_sort_range(pool, values, buffer, middle, end, !to_buffer, less);
+    };
+
+    if (size > Sorting::parallel_sort_grain)
+    {
+        pool.invoke(sort_left, sort_right);
+    }
+    else
+    {
+        sort_left();
+        sort_right();
+    }
+
+    if (to_buffer)
+    {
+        Sorting::parallel_merge(pool, values, buffer, begin, middle, end, less);
+    }
+    else
+    {
+        Sorting::parallel_merge(pool, buffer, values, begin, middle, end, less);
+    }
+}
+
+/**
+ * @brief Merges the sorted runs [begin, middle) and [middle, end) of the source into the target.
+ * 
+ * The output is cut into one piece per thread, each at least parallel_merge_grain
+ * records long. Where a piece starts the merge path is found by binary search: the
+ * number of records the first `diagonal` outputs take from the left run. Ties go to
+ * the left run, same as in the serial merge, so the pieces merge independently into
+ * exactly the serial result.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::parallel_merge(WorkStealingPool& pool, std::vector<Record>& source, std::vector<Record>& target, std::size_t begin, std::size_t middle, std::size_t end, Less less)
+{
+    std::size_t size = end - begin;
+    std::size_t parts = std::min(pool.thread_count(), size / Sorting::parallel_merge_grain);
+
+    if (parts <= 1)
+    {
+        Sorting::merge_runs(source, begin, middle, middle, end, target, begin, less);
+        return;
+    }
+
+    auto merge_path = [&](std::size_t diagonal)
+    {
+        std::size_t low = (diagonal > end - middle) ? diagonal - (end - middle) : 0;
+        std::size_t high = std::min(diagonal, middle - begin);
+
+        while (low < high)
+        {
+            std::size_t taken = low + (high - low) / 2;
+
+            if (!less(source[middle + (diagonal - taken - 1)], source[begin + taken]))
+            {
+                low = taken + 1;
+            }
+            else
+            {
+                high = taken;
+            }
+        }
+        return low;
+    };
+
+    // Merging moves records out of the source, so every split is found before any piece starts.
+    std::vector<std::size_t> splits(parts + 1);
+
+    for (std::size_t part = 0; part <= parts; ++part)
+    {
+        splits[part] = merge_path(size * part / parts);
+    }
+
+    pool.parallel_for(0, parts, [&](std::size_t part)
+    {
+        std::size_t first = size * part / parts;
+        std::size_t last = size * (part + 1) / parts;
+
+        Sorting::merge_runs(source, begin + splits[part], begin + splits[part + 1], middle + (first - splits[part]), middle + (last - splits[part + 1]), target, begin + first, less);
+    });
+}
+
+/**
+ * @brief Moves two sorted runs of the source into the target, merged.
+ * 
+ * @return void.
+ */
+template<typename Record, typename Less>
+void Sorting::merge_runs(std::vector<Record>& source, std::size_t left, std::size_t left_end, std::size_t right, std::size_t right_end, std::vector<Record>& target, std::size_t output, Less less)
+{
+    while (left < left_end && right < right_end)
+    {
+        if (less(source[right], source[left]))
+        {
+            target[output++] = std::move(source[right++]);
+        }
+        else
+        {
+            target[output++] = std::move(source[left++]);
+        }
+    }
+
+    while (left < left_end)
+    {
+        target[output++] = std::move(source[left++]);
+    }
+
+    while (right < right_end)
+    {
+        target[output++] = std::move(source[right++]);
+    }
+}
+
 #endif // SORTING_HPP
\ No newline at end of file
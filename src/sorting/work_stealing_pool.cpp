@@ -0,0 +1,246 @@
+/**
+ * @file       <work_stealing_pool.cpp>
+ * @brief      This source file holds implementation of WorkStealingPool class.
+ *
+ *             This calss implements a fork-join thread pool that balances its tasks by work stealing.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#include "work_stealing_pool.hpp"
+
+#include <algorithm>
+
+WorkStealingPool::WorkStealingPool(std::size_t threads)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    this->_thread_count = std::max<std::size_t>(1, threads);
+    this->_queues = std::make_unique<TaskQueue[]>(this->_thread_count);
+    this->_pending.store(0);
+    this->_parked.store(0);
+    this->_stopping.store(false);
+
+    this->_workers.reserve(this->_thread_count - 1);
+
+    for (std::size_t queue = 1; queue < this->_thread_count; ++queue)
+    {
+        this->_workers.emplace_back(&WorkStealingPool::work, this, queue);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->_sleep_mutex);
+        this->_stopping.store(true);
+    }
+
+    this->_wake.notify_all();
+
+    for (std::thread& worker : this->_workers)
+    {
+        worker.join();
+    }
+    return;
+}
+
+std::size_t WorkStealingPool::thread_count() const
+{
+    return this->_thread_count;
+}
+
+WorkStealingPool::Worker& WorkStealingPool::worker()
+{
+    thread_local Worker worker{nullptr, 0};
+
+    return worker;
+}
+
+std::size_t WorkStealingPool::queue_index() const
+{
+    const Worker& worker = WorkStealingPool::worker();
+
+    return (worker.pool == this) ? worker.queue : 0;
+}
+
+/**
+ * The pending count is raised before the sleep mutex is taken, so a worker either sees
+ * it when it checks for work under that mutex or is already waiting for the notification.
+ */
+void WorkStealingPool::push(Task* task)
+{
+    TaskQueue& queue = this->_queues[this->queue_index()];
+
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+
+    this->_pending.fetch_add(1);
+
+    {
+        std::lock_guard<std::mutex> lock(this->_sleep_mutex);
+    }
+
+    this->_wake.notify_one();
+}
+
+bool WorkStealingPool::pop_local(Task* task)
+{
+    TaskQueue& queue = this->_queues[this->queue_index()];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty() || queue.tasks.back() != task)
+    {
+        return false;
+    }
+
+    queue.tasks.pop_back();
+    this->_pending.fetch_sub(1);
+
+    return true;
+}
+
+WorkStealingPool::Task* WorkStealingPool::find_task(std::size_t queue)
+{
+    {
+        TaskQueue& own_queue = this->_queues[queue];
+        std::lock_guard<std::mutex> lock(own_queue.mutex);
+
+        if (!own_queue.tasks.empty())
+        {
+            Task* task = own_queue.tasks.back();
+
+            own_queue.tasks.pop_back();
+            this->_pending.fetch_sub(1);
+
+            return task;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < this->_thread_count; ++offset)
+    {
+        TaskQueue& victim = this->_queues[(queue + offset) % this->_thread_count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty())
+        {
+            Task* task = victim.tasks.front();
+
+            victim.tasks.pop_front();
+            this->_pending.fetch_sub(1);
+
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * The task lives on the stack of the thread that forked it, which may return as soon
+ * as it sees the task done, so the task is not touched after that. Either this thread
+ * sees a waiter counted in _parked, or that waiter sees the task done before it sleeps.
+ */
+void WorkStealingPool::run(Task* task)
+{
+    try
+    {
+        task->execute(task->context);
+    }
+    catch (...)
+    {
+        task->error = std::current_exception();
+    }
+
+    task->done.store(true);
+
+    if (this->_parked.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->_sleep_mutex);
+        }
+
+        this->_wake.notify_all();
+    }
+}
+
+void WorkStealingPool::wait(Task& task)
+{
+    std::size_t queue = this->queue_index();
+    std::size_t idle_rounds = 0;
+
+    while (!task.done.load(std::memory_order_acquire))
+    {
+        Task* other = this->find_task(queue);
+
+        if (other != nullptr)
+        {
+            this->run(other);
+            idle_rounds = 0;
+            continue;
+        }
+
+        if (++idle_rounds < WorkStealingPool::spin_rounds)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        this->_parked.fetch_add(1);
+
+        {
+            std::unique_lock<std::mutex> lock(this->_sleep_mutex);
+
+            this->_wake.wait(lock, [&]()
+            {
+                return task.done.load() || this->_pending.load() > 0;
+            });
+        }
+
+        this->_parked.fetch_sub(1);
+        idle_rounds = 0;
+    }
+}
+
+void WorkStealingPool::work(std::size_t queue)
+{
+    WorkStealingPool::worker() = Worker{this, queue};
+
+    while (true)
+    {
+        Task* task = this->find_task(queue);
+
+        if (task != nullptr)
+        {
+            this->run(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->_sleep_mutex);
+
+        this->_wake.wait(lock, [&]()
+        {
+            return this->_stopping.load() || this->_pending.load() > 0;
+        });
+
+        if (this->_stopping.load())
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,244 @@
+/**
+ * @file       <work_stealing_pool.hpp>
+ * @brief      This header file holds implementation of WorkStealingPool class.
+ *
+ *             This calss implements a fork-join thread pool that balances its tasks by work stealing.
+ *
+ * @author     Alexander Chudnikov (THE_CHOODICK)
+ * @date       15-02-2023
+ * @version    0.0.1
+ *
+ * @warning    This library is under development, so there might be some bugs in it.
+ * @bug        Currently, there are no any known bugs.
+ *
+ *             In order to submit new ones, please contact me via admin@redline-software.xyz.
+ *
+ * @copyright  Copyright 2023 Alexander. All rights reserved.
+ *
+ *             (Not really)
+ */
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class WorkStealingPool
+ * @brief Fork-join thread pool for recursive divide and conquer algorithms.
+ *
+ * Every thread owns a task queue. A forked task is pushed to the back of the queue of
+ * the thread that forks it, which works on the other half itself and then takes the
+ * task back if nobody stole it. Idle threads steal from the front of other queues,
+ * where the oldest and therefore largest tasks are. A thread waiting for a stolen task
+ * runs other tasks meanwhile, so nested forks never block a thread. When there is
+ * nothing left to run it yields for a while and then sleeps until the task is done
+ * or new work is pushed.
+ *
+ * The thread that calls into the pool is one of its threads, a pool of one thread
+ * starts no workers and runs everything in place.
+ */
+class WorkStealingPool
+{
+public:
+    /**
+     * @brief Constructor for the WorkStealingPool class.
+     *
+     * @param threads The number of threads including the calling one, 0 for every hardware thread.
+     */
+    explicit WorkStealingPool(std::size_t threads = 0);
+
+    /**
+     * @brief Destructor for the WorkStealingPool class, stops the workers.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Gets the number of threads, the calling one included.
+     *
+     * @return The number of threads.
+     */
+    std::size_t thread_count() const;
+
+    /**
+     * @brief Runs two functions, possibly in parallel, and waits for both.
+     *
+     * The left function is offered to other threads, the right one runs on the calling
+     * thread. If either throws, the exception is rethrown once both have finished.
+     *
+     * @tparam Left Callable without arguments.
+     * @tparam Right Callable without arguments.
+     * @param left The function offered to other threads.
+     * @param right The function run by the calling thread.
+     */
+    template<typename Left, typename Right>
+        void invoke(Left&& left, Right&& right);
+
+    /**
+     * @brief Calls a function for every index of [begin, end), possibly in parallel.
+     *
+     * The range is halved recursively through invoke.
+     *
+     * @tparam Function Callable taking an index.
+     * @param begin The first index.
+     * @param end The index past the last one.
+     * @param function The function.
+     */
+    template<typename Function>
+        void parallel_for(std::size_t begin, std::size_t end, Function&& function);
+
+private:
+    static constexpr std::size_t spin_rounds = 64;  ///< Empty searches a waiting thread yields through before it sleeps.
+
+    struct Task
+    {
+        void                (*execute)(void* context);
+        void*               context;
+        std::atomic<bool>   done;
+        std::exception_ptr  error;
+    };
+
+    struct alignas(64) TaskQueue
+    {
+        std::mutex          mutex;
+        std::deque<Task*>   tasks;
+    };
+
+    struct Worker
+    {
+        const WorkStealingPool*     pool;
+        std::size_t                 queue;
+    };
+
+    /**
+     * @brief The pool and queue of the calling thread, if it is a worker.
+     */
+    static Worker& worker();
+
+    /**
+     * @brief The queue of the calling thread, threads outside of the pool share queue 0.
+     */
+    std::size_t queue_index() const;
+
+    void push(Task* task);
+
+    /**
+     * @brief Takes a task back from the queue of the calling thread unless it was stolen.
+     */
+    bool pop_local(Task* task);
+
+    /**
+     * @brief Takes the newest task of the given queue, or else steals the oldest task of another.
+     */
+    Task* find_task(std::size_t queue);
+
+    /**
+     * @brief Runs a task and wakes the sleeping waiters, if any, once it is done.
+     */
+    void run(Task* task);
+
+    /**
+     * @brief Runs other tasks until the given one is done, sleeping when there are none.
+     */
+    void wait(Task& task);
+
+    void work(std::size_t queue);
+
+    std::size_t                     _thread_count;
+    std::unique_ptr<TaskQueue[]>    _queues;
+    std::vector<std::thread>        _workers;
+    std::atomic<std::int64_t>       _pending;   ///< Tasks in the queues, may briefly run ahead of or behind them.
+    std::atomic<std::size_t>        _parked;    ///< Threads sleeping in wait.
+    std::atomic<bool>               _stopping;
+    std::mutex                      _sleep_mutex;
+    std::condition_variable         _wake;
+};
+
+template<typename Left, typename Right>
+void WorkStealingPool::invoke(Left&& left, Right&& right)
+{
+    if (this->_thread_count == 1)
+    {
+        left();
+        right();
+        return;
+    }
+
+    Task task;
+
+    task.execute = [](void* context)
+    {
+        (*static_cast<std::remove_reference_t<Left>*>(context))();
+    };
+    task.context = const_cast<void*>(static_cast<const void*>(std::addressof(left)));
+    task.done.store(false, std::memory_order_relaxed);
+
+    this->push(&task);
+
+    std::exception_ptr error;
+
+    try
+    {
+        right();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    if (this->pop_local(&task))
+    {
+        this->run(&task);
+    }
+    else
+    {
+        this->wait(task);
+    }
+
+    if (task.error)
+    {
+        std::rethrow_exception(task.error);
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+template<typename Function>
+void WorkStealingPool::parallel_for(std::size_t begin, std::size_t end, Function&& function)
+{
+    if (end - begin <= 1)
+    {
+        if (begin < end)
+        {
+            function(begin);
+        }
+        return;
+    }
+
+    std::size_t middle = begin + (end - begin) / 2;
+
+    this->invoke([&]()
+    {
+        this->parallel_for(begin, middle, function);
+    }, [&]()
+    {
+        this->parallel_for(middle, end, function);
+    });
+}
+
+#endif // WORK_STEALING_POOL_HPP